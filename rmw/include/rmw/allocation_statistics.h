@@ -0,0 +1,135 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__ALLOCATION_STATISTICS_H_
+#define RMW__ALLOCATION_STATISTICS_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+/// Number of buckets in an allocation size histogram.
+/**
+ * Bucket `i` counts allocations of `[2^i, 2^(i+1))` bytes, except for the first
+ * bucket which also counts empty allocations, and the last bucket which counts
+ * everything larger.
+ */
+#define RMW_ALLOCATION_SIZE_HISTOGRAM_BUCKETS 32
+
+/// Places in rmw where memory is allocated, as tracked by allocation statistics.
+typedef enum RMW_PUBLIC_TYPE rmw_allocation_site_e
+{
+  /// Direct calls to `rmw_allocate()`
+  RMW_ALLOCATION_SITE_GENERIC = 0,
+  /// `rmw_node_allocate()`
+  RMW_ALLOCATION_SITE_NODE,
+  /// `rmw_publisher_allocate()`
+  RMW_ALLOCATION_SITE_PUBLISHER,
+  /// `rmw_subscription_allocate()`
+  RMW_ALLOCATION_SITE_SUBSCRIPTION,
+  /// `rmw_guard_condition_allocate()`
+  RMW_ALLOCATION_SITE_GUARD_CONDITION,
+  /// `rmw_client_allocate()`
+  RMW_ALLOCATION_SITE_CLIENT,
+  /// `rmw_service_allocate()`
+  RMW_ALLOCATION_SITE_SERVICE,
+  /// `rmw_wait_set_allocate()`
+  RMW_ALLOCATION_SITE_WAIT_SET,
+  /// Number of allocation sites, not a valid site itself.
+  RMW_ALLOCATION_SITE_COUNT
+} rmw_allocation_site_t;
+
+/// Allocation statistics of a single allocation site.
+typedef struct RMW_PUBLIC_TYPE rmw_allocation_site_statistics_s
+{
+  /// Number of allocations made since the start of the process.
+  uint64_t total_count;
+  /// Number of bytes allocated since the start of the process.
+  uint64_t total_bytes;
+  /// Number of allocations not yet freed.
+  uint64_t live_count;
+  /// Number of bytes not yet freed.
+  uint64_t live_bytes;
+  /// Highest value `live_bytes` has reached.
+  uint64_t peak_bytes;
+  /// Number of allocations made, by size, see `RMW_ALLOCATION_SIZE_HISTOGRAM_BUCKETS`.
+  uint64_t size_histogram[RMW_ALLOCATION_SIZE_HISTOGRAM_BUCKETS];
+} rmw_allocation_site_statistics_t;
+
+/// Snapshot of the allocation statistics of the rmw allocators.
+typedef struct RMW_PUBLIC_TYPE rmw_allocation_statistics_s
+{
+  /// Statistics for each allocation site, indexed by `rmw_allocation_site_t`.
+  rmw_allocation_site_statistics_t sites[RMW_ALLOCATION_SITE_COUNT];
+  /// Number of bytes not yet freed, over all sites.
+  uint64_t live_bytes;
+  /// Highest value `live_bytes` has reached.
+  uint64_t peak_bytes;
+} rmw_allocation_statistics_t;
+
+/// Check whether allocation statistics were enabled when rmw was built.
+/**
+ * Statistics are opt-in, enabled by configuring rmw with
+ * `-DRMW_ENABLE_ALLOCATION_STATISTICS=ON`.
+ * When enabled, `rmw_allocate()` stores the size of each block in a small
+ * header in front of it, so that `rmw_free()` can account for it.
+ *
+ * \return `true` if allocation statistics are collected, or
+ * \return `false` otherwise.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+bool
+rmw_allocation_statistics_are_enabled(void);
+
+/// Get a snapshot of the allocation statistics of the rmw allocators.
+/**
+ * Entity structs are accounted for at their own site whether they come from
+ * an entity pool or from the heap.
+ *
+ * Counters are updated with relaxed atomics, so a snapshot taken while other
+ * threads allocate is not guaranteed to be consistent across counters.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [1]
+ * <i>[1] if `atomic_is_lock_free()` returns true for `atomic_uint_least64_t`</i>
+ *
+ * \param[out] statistics snapshot of the allocation statistics
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `statistics` is NULL, or
+ * \return `RMW_RET_UNSUPPORTED` if allocation statistics are not enabled.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_allocation_statistics(rmw_allocation_statistics_t * statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__ALLOCATION_STATISTICS_H_
@@ -20,11 +20,90 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
 #include "rmw/types.h"
 #include "rmw/visibility_control.h"
 
-/// Allocate memory of size in bytes using rcutils default allocator's allocate()
+/// Number of calls made into the rmw default allocator.
+typedef struct RMW_PUBLIC_TYPE rmw_allocation_counts_s
+{
+  /// Number of blocks successfully allocated from the rmw default allocator.
+  uint64_t allocations;
+  /// Number of blocks returned to the rmw default allocator.
+  uint64_t deallocations;
+} rmw_allocation_counts_t;
+
+/// Set the process wide allocator used by `rmw_allocate()` and `rmw_free()`.
+/**
+ * This allocator also backs the `rmw_*_allocate()` entity functions whenever they
+ * are not served from an entity pool, see `rmw/entity_pool.h`.
+ * Passing `NULL` restores the rcutils default allocator.
+ *
+ * Memory must be freed with the same allocator it was allocated with, so this
+ * should be called before anything is allocated through rmw, typically before
+ * `rmw_init()`, or after all such memory has been freed.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] allocator allocator to be used, or `NULL`
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is not valid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_set_default_allocator(const rcutils_allocator_t * allocator);
+
+/// Get the process wide allocator used by `rmw_allocate()` and `rmw_free()`.
+/**
+ * \return the allocator set with `rmw_set_default_allocator()`, or
+ * \return the rcutils default allocator if none was set.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rcutils_allocator_t
+rmw_get_default_allocator(void);
+
+/// Get the number of allocations and deallocations made through the rmw default allocator.
 /**
+ * Counts are cumulative for the lifetime of the process, so comparing two
+ * snapshots taken around a code path tells whether it allocated.
+ * Entities served from an entity pool do not count as allocations.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [1]
+ * <i>[1] if `atomic_is_lock_free()` returns true for `atomic_uint_least64_t`</i>
+ *
+ * \param[out] counts snapshot of the allocation counts
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `counts` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_allocation_counts(rmw_allocation_counts_t * counts);
+
+/// Allocate zero initialized memory of size in bytes using the rmw default allocator
+/**
+ * Memory is obtained from the allocator's zero_allocate(), which may avoid
+ * clearing memory that is already known to be zeroed.
+ *
  * \param[in] size The number of bytes to allocate
  * \return pointer to allocated memory
  */
@@ -32,7 +111,20 @@ RMW_PUBLIC
 void *
 rmw_allocate(size_t size);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Allocate memory of size in bytes using the rmw default allocator's allocate()
+/**
+ * Unlike `rmw_allocate()`, the contents of the returned memory are left
+ * indeterminate, so use this only when the caller overwrites all of it anyway.
+ * The memory must be released with `rmw_free()`.
+ *
+ * \param[in] size The number of bytes to allocate
+ * \return pointer to allocated memory
+ */
+RMW_PUBLIC
+void *
+rmw_allocate_uninitialized(size_t size);
+
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] pointer pointer to allocated memory
  */
@@ -40,15 +132,18 @@ RMW_PUBLIC
 void
 rmw_free(void * pointer);
 
-/// Allocate memory for an `rmw_node_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_node_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_node_t *
 rmw_node_allocate(void);
 
-/// Free memory allocated to this node pointer using rcutils default allocator's deallocate()
+/// Free memory allocated to this node pointer using the rmw default allocator's deallocate()
 /**
  * \param[in] node pointer to allocated memory
  */
@@ -56,15 +151,18 @@ RMW_PUBLIC
 void
 rmw_node_free(rmw_node_t * node);
 
-/// Allocate memory for an `rmw_publisher_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_publisher_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_publisher_t *
 rmw_publisher_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] publisher pointer to allocated memory
  */
@@ -72,15 +170,18 @@ RMW_PUBLIC
 void
 rmw_publisher_free(rmw_publisher_t * publisher);
 
-/// Allocate memory for an `rmw_subscription_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_subscription_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_subscription_t *
 rmw_subscription_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] subscription pointer to allocated memory
  */
@@ -88,15 +189,18 @@ RMW_PUBLIC
 void
 rmw_subscription_free(rmw_subscription_t * subscription);
 
-/// Allocate memory for an `rmw_guard_condition_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_guard_condition_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_guard_condition_t *
 rmw_guard_condition_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] guard_condition pointer to allocated memory
  */
@@ -104,15 +208,18 @@ RMW_PUBLIC
 void
 rmw_guard_condition_free(rmw_guard_condition_t * guard_condition);
 
-/// Allocate memory for an `rmw_client_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_client_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_client_t *
 rmw_client_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] client pointer to allocated memory
  */
@@ -120,15 +227,18 @@ RMW_PUBLIC
 void
 rmw_client_free(rmw_client_t * client);
 
-/// Allocate memory for an `rmw_service_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_service_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_service_t *
 rmw_service_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] service pointer to allocated memory
  */
@@ -136,15 +246,18 @@ RMW_PUBLIC
 void
 rmw_service_free(rmw_service_t * service);
 
-/// Allocate memory for an `rmw_wait_set_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_wait_set_t` using the rmw default allocator's allocate()
 /**
+ * If its entity pool was set up with `rmw_entity_pools_init()`, a block is taken
+ * from the pool instead, unless the pool is exhausted.
+ *
  * \return pointer to allocated memory
  */
 RMW_PUBLIC
 rmw_wait_set_t *
 rmw_wait_set_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using the rmw default allocator's deallocate()
 /**
  * \param[in] wait_set pointer to allocated memory
  */
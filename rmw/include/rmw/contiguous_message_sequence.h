@@ -0,0 +1,193 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__CONTIGUOUS_MESSAGE_SEQUENCE_H_
+#define RMW__CONTIGUOUS_MESSAGE_SEQUENCE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/message_sequence.h"
+#include "rmw/ret_types.h"
+#include "rmw/time.h"
+#include "rmw/types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Alignment, in bytes, of the storage owned by contiguous sequences.
+#define RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT 64u
+
+/// Structure to hold a sequence of fixed-size ROS messages in one contiguous slab.
+/**
+ * Messages are laid out back to back, `message_stride` bytes apart, starting at
+ * `messages`, which is aligned to `RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT`.
+ *
+ * `sequence` is a regular message sequence whose entries point into the slab,
+ * so it can be passed to `rmw_take_sequence()` as is.
+ * Its `size` is the number of valid messages.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_contiguous_message_sequence_s
+{
+  /// Message sequence view over the slab, with `capacity` entries.
+  rmw_message_sequence_t sequence;
+  /// First message of the slab.
+  void * messages;
+  /// Size of a single message, in bytes.
+  size_t message_size;
+  /// Distance between two consecutive messages, in bytes.
+  size_t message_stride;
+  /// Block returned by the allocator, holding both the slab and the sequence entries.
+  void * storage;
+} rmw_contiguous_message_sequence_t;
+
+/// Structure to hold a sequence of message infos, one array per field.
+/**
+ * The i-th message info is spread over the i-th entry of each array.
+ * All arrays live in a single allocation, each aligned to
+ * `RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT`.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_message_info_soa_sequence_s
+{
+  /// Source timestamps, see `rmw_message_info_t::source_timestamp`.
+  rmw_time_point_value_t * source_timestamps;
+  /// Reception timestamps, see `rmw_message_info_t::received_timestamp`.
+  rmw_time_point_value_t * received_timestamps;
+  /// Publication sequence numbers, see `rmw_message_info_t::publication_sequence_number`.
+  uint64_t * publication_sequence_numbers;
+  /// Reception sequence numbers, see `rmw_message_info_t::reception_sequence_number`.
+  uint64_t * reception_sequence_numbers;
+  /// Publisher GIDs, see `rmw_message_info_t::publisher_gid`.
+  rmw_gid_t * publisher_gids;
+  /// Intra-process flags, see `rmw_message_info_t::from_intra_process`.
+  bool * from_intra_process;
+  /// The number of valid entries in each array.
+  size_t size;
+  /// The total allocated capacity of each array.
+  size_t capacity;
+  /// The allocator used to allocate the arrays.
+  rcutils_allocator_t * allocator;
+  /// Block returned by the allocator, holding all arrays.
+  void * storage;
+} rmw_message_info_soa_sequence_t;
+
+/// Return an rmw_contiguous_message_sequence_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_contiguous_message_sequence_t
+rmw_get_zero_initialized_contiguous_message_sequence(void);
+
+/// Initialize an rmw_contiguous_message_sequence_t object.
+/**
+ * The slab is zero initialized.
+ * Messages whose type needs it must still be initialized in place, e.g. with
+ * their generated `__init()` function, before being taken into.
+ *
+ * \param[inout] sequence sequence object to be initialized.
+ * \param[in] capacity number of messages the slab can hold.
+ * \param[in] message_size size of a single message, in bytes.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message_size` is zero, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_contiguous_message_sequence_init(
+  rmw_contiguous_message_sequence_t * sequence,
+  size_t capacity,
+  size_t message_size,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_contiguous_message_sequence_t object.
+/**
+ * Note: This will not call `fini` on the messages living in the slab.
+ *
+ * \param[inout] sequence sequence object to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the sequence allocator is invalid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_contiguous_message_sequence_fini(rmw_contiguous_message_sequence_t * sequence);
+
+/// Return an rmw_message_info_soa_sequence_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_message_info_soa_sequence_t
+rmw_get_zero_initialized_message_info_soa_sequence(void);
+
+/// Initialize an rmw_message_info_soa_sequence_t object.
+/**
+ * \param[inout] sequence sequence object to be initialized.
+ * \param[in] capacity capacity of each array to be allocated.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_soa_sequence_init(
+  rmw_message_info_soa_sequence_t * sequence,
+  size_t capacity,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_message_info_soa_sequence_t object.
+/**
+ * \param[inout] sequence sequence object to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the sequence allocator is invalid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_soa_sequence_fini(rmw_message_info_soa_sequence_t * sequence);
+
+/// Scatter a sequence of message infos into the per-field arrays of a SoA sequence.
+/**
+ * This is meant to be called right after `rmw_take_sequence()`, replacing the
+ * contents of `dst` with those of `src`.
+ *
+ * \param[in] src sequence of message infos to copy from.
+ * \param[inout] dst SoA sequence to copy into, with a capacity of at least `src->size`.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `src` or `dst` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `dst` capacity is less than `src` size.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_soa_sequence_copy_from(
+  const rmw_message_info_sequence_t * src,
+  rmw_message_info_soa_sequence_t * dst);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__CONTIGUOUS_MESSAGE_SEQUENCE_H_
@@ -0,0 +1,168 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__ENTITY_POOL_H_
+#define RMW__ENTITY_POOL_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+/// Kinds of entity structs which can be served from a preallocated pool.
+/**
+ * Each kind maps to one of the `rmw_*_allocate()` / `rmw_*_free()` pairs
+ * declared in `rmw/allocators.h`.
+ */
+typedef enum RMW_PUBLIC_TYPE rmw_entity_pool_type_e
+{
+  /// Pool for `rmw_node_t`
+  RMW_ENTITY_POOL_NODE = 0,
+  /// Pool for `rmw_publisher_t`
+  RMW_ENTITY_POOL_PUBLISHER,
+  /// Pool for `rmw_subscription_t`
+  RMW_ENTITY_POOL_SUBSCRIPTION,
+  /// Pool for `rmw_guard_condition_t`
+  RMW_ENTITY_POOL_GUARD_CONDITION,
+  /// Pool for `rmw_client_t`
+  RMW_ENTITY_POOL_CLIENT,
+  /// Pool for `rmw_service_t`
+  RMW_ENTITY_POOL_SERVICE,
+  /// Pool for `rmw_wait_set_t`
+  RMW_ENTITY_POOL_WAIT_SET,
+  /// Number of entity pool types, not a valid type itself.
+  RMW_ENTITY_POOL_TYPE_COUNT
+} rmw_entity_pool_type_t;
+
+/// Options used to size the entity pools.
+typedef struct RMW_PUBLIC_TYPE rmw_entity_pool_options_s
+{
+  /// Number of entity structs to preallocate, indexed by `rmw_entity_pool_type_t`.
+  /**
+   * A capacity of zero leaves that pool disabled, in which case the matching
+   * `rmw_*_allocate()` function always allocates from the heap.
+   */
+  size_t capacity[RMW_ENTITY_POOL_TYPE_COUNT];
+} rmw_entity_pool_options_t;
+
+/// Return a zero initialized entity pool options structure.
+/**
+ * Zero initialized options leave every pool disabled.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_entity_pool_options_t
+rmw_get_zero_initialized_entity_pool_options(void);
+
+/// Preallocate the entity pools described by the given options.
+/**
+ * Each enabled pool is a single contiguous slab of fixed-size blocks, threaded
+ * onto a free list.
+ * While a pool is initialized, the matching `rmw_*_allocate()` function pops a
+ * block from it instead of calling into the heap, and the matching `rmw_*_free()`
+ * function pushes it back.
+ * Once a pool is exhausted, further allocations are zero initialized blocks taken
+ * directly from the allocator returned by `rmw_get_default_allocator()`.
+ * Unlike `rmw_allocate()` blocks, they have no size header, and allocation statistics
+ * record them under their entity type only.
+ *
+ * Pools are process wide and reference counted, so that several contexts may
+ * each call this function from `rmw_init()`.
+ * Only the first successful call for a given pool allocates its slab; capacities
+ * passed on subsequent calls are ignored until the pool is finalized.
+ *
+ * The given allocator is stored and later used by `rmw_entity_pools_fini()`.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \param[in] options capacities of the pools to set up
+ * \param[in] allocator allocator used to allocate the pool slabs
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `options` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is NULL or invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if allocating memory failed, in which case
+ *   no pool is left initialized by this call.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_entity_pools_init(
+  const rmw_entity_pool_options_t * options,
+  const rcutils_allocator_t * allocator);
+
+/// Release one reference on every pool set up by `rmw_entity_pools_init()`.
+/**
+ * A pool's slab is deallocated once its last reference is released.
+ * A pool which still has blocks in use is left untouched, as freeing it would
+ * invalidate the entities living in it.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_ERROR` if a pool still had blocks in use.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_entity_pools_fini(void);
+
+/// Get the number of blocks in use and the capacity of an entity pool.
+/**
+ * Blocks allocated from the heap once the pool was exhausted are not counted.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \param[in] type pool to query
+ * \param[out] in_use number of blocks currently handed out by the pool
+ * \param[out] capacity total number of blocks in the pool, zero if disabled
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `type` is not a valid pool type, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `in_use` or `capacity` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_entity_pool_get_usage(rmw_entity_pool_type_t type, size_t * in_use, size_t * capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__ENTITY_POOL_H_
@@ -51,6 +51,31 @@ typedef enum RMW_PUBLIC_TYPE rmw_feature_e
   RMW_MIDDLEWARE_SUPPORTS_TYPE_DISCOVERY = 2,
   /// dynamic type subscriptions will use take_dynamic_message_with_info()
   RMW_MIDDLEWARE_CAN_TAKE_DYNAMIC_MESSAGE = 3,
+  /// rmw_publish_sequence() is implemented, rather than returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_PUBLISH_SEQUENCE = 4,
+  /// rmw_publish_serialized_sequence() and rmw_take_serialized_sequence() are implemented,
+  /// rather than returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_SERIALIZED_SEQUENCE = 5,
+  /// rmw_publish_serialized_message_iov() and rmw_take_serialized_message_iov_with_info() are
+  /// implemented, rather than returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_SERIALIZED_MESSAGE_IOV = 6,
+  /// rmw_get_serialized_size() and rmw_serialize_into() are implemented, rather than
+  /// returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_SERIALIZE_INTO = 7,
+  /// rmw_serialize_sequence() and rmw_deserialize_sequence() are implemented, rather than
+  /// returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_SERIALIZE_SEQUENCE = 8,
+  /// rmw_streaming_deserializer_init() and the functions using its result are implemented,
+  /// rather than returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_STREAMING_DESERIALIZATION = 9,
+  /// rmw_get_graph_events() is implemented, rather than returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_GRAPH_EVENTS = 10,
+  /// rmw_graph_get_generation() and rmw_graph_get_topic_generation() are implemented,
+  /// rather than returning `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_GRAPH_GENERATION = 11,
+  /// rmw_get_topic_names_and_types_filtered() is implemented, rather than returning
+  /// `RMW_RET_UNSUPPORTED`
+  RMW_FEATURE_FILTERED_GRAPH_QUERIES = 12,
 } rmw_feature_t;
 
 /// Query if a feature is supported by the rmw implementation.
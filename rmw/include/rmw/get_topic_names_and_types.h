@@ -22,6 +22,7 @@ extern "C"
 
 #include "rmw/macros.h"
 #include "rmw/names_and_types.h"
+#include "rmw/topic_filter.h"
 #include "rmw/types.h"
 #include "rmw/visibility_control.h"
 
@@ -96,6 +97,93 @@ rmw_get_topic_names_and_types(
   bool no_demangle,
   rmw_names_and_types_t * topic_names_and_types);
 
+/// Return the topic names and types in the ROS graph selected by a filter.
+/**
+ * This function returns the same topic names and types as rmw_get_topic_names_and_types()
+ * would, but only for those selected by `filter`, i.e. whose name matches the filter
+ * pattern and that have an endpoint of the filter endpoint kind.
+ * Types are those of the selected endpoints only, e.g. of publishers when the filter
+ * selects topics with publishers.
+ *
+ * rmw implementations are expected to answer from an index, e.g. of topic names sorted so
+ * that only those starting with the literal prefix of the pattern are looked at,
+ * as given by rmw_topic_pattern_get_prefix_length(), and to allocate memory for the
+ * selected topics only.
+ * Processes interested in a slice of a large ROS graph, e.g. their own namespace on a
+ * multi-robot system, thus do work proportional to the slice rather than to the graph.
+ *
+ * Callers should check the `RMW_FEATURE_FILTERED_GRAPH_QUERIES` feature, and otherwise
+ * filter rmw_get_topic_names_and_types() results with rmw_topic_name_matches().
+ * That fallback only applies `filter->pattern`.
+ * To also apply `filter->endpoint_type`, callers must drop the remaining topics for which
+ * rmw_count_publishers() or rmw_count_subscribers() returns zero, and the types listed are
+ * still those of all endpoints of each topic.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Runtime behavior
+ *   To query the ROS graph is a synchronous operation.
+ *   It is also non-blocking, but it is not guaranteed to be lock-free.
+ *   Generally speaking, implementations may synchronize access to internal resources using
+ *   locks but are not allowed to wait for events with no guaranteed time bound (barring
+ *   the effects of starvation due to OS scheduling).
+ *
+ * \par Thread-safety
+ *   Nodes are thread-safe objects, and so are all operations on them except for finalization.
+ *   Therefore, it is safe to query the ROS graph using the same node concurrently.
+ *   However, when querying topic names and types:
+ *   - Access to the array of names and types is not synchronized.
+ *     It is not safe to read or write `topic_names_and_types`
+ *     while rmw_get_topic_names_and_types_filtered() uses it.
+ *   - Access to the filter is read-only but it is not synchronized.
+ *     Concurrent `filter` reads are safe, but concurrent reads and writes are not.
+ *   - The default allocators are thread-safe objects, but any custom `allocator` may not be.
+ *     Check your allocator documentation for further reference.
+ *
+ * \pre Given `node` must be a valid node handle, as returned by rmw_create_node().
+ * \pre Given `topic_names_and_types` must be a zero-initialized array of names and types,
+ *   as returned by rmw_get_zero_initialized_names_and_types().
+ *
+ * \param[in] node Node to query the ROS graph.
+ * \param[in] allocator Allocator to be used when populating the `topic_names_and_types` array.
+ * \param[in] filter Filter selecting topics, matched against demangled topic names unless
+ *   `no_demangle` is true.
+ * \param[in] no_demangle Whether to demangle all topic names following ROS conventions or not.
+ * \param[out] topic_names_and_types Array of selected topic names and their types,
+ *   populated on success but left unchanged on failure.
+ *   If populated, it is up to the caller to finalize this array later on
+ *   using rmw_names_and_types_fini().
+ * \return `RMW_RET_OK` if the query was successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `node` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is not valid, by rcutils_allocator_is_valid()
+ *   definition, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `filter` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `topic_names_and_types` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `topic_names_and_types` is not a
+ *   zero-initialized array, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `node` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unspecified error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_topic_names_and_types_filtered(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const rmw_topic_filter_t * filter,
+  bool no_demangle,
+  rmw_names_and_types_t * topic_names_and_types);
+
 #ifdef __cplusplus
 }
 #endif
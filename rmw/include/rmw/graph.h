@@ -0,0 +1,148 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__GRAPH_H_
+#define RMW__GRAPH_H_
+
+#include <stdint.h>
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Retrieve the current generation of the ROS graph.
+/**
+ * The ROS graph generation is a counter the rmw implementation increments on every change
+ * to the graph discovered by the given node's context, starting from 0.
+ * It is the generation rmw_get_graph_events() reports changes against.
+ *
+ * Callers may cache the results of graph queries, e.g. rmw_get_topic_names_and_types(),
+ * rmw_get_service_names_and_types() or rmw_count_publishers(), along with the generation
+ * retrieved right before querying, and only query again once the generation differs.
+ * Changes made while querying bump the generation, so they are never missed, at worst
+ * they cause a spurious query.
+ *
+ * Callers should check the `RMW_FEATURE_GRAPH_GENERATION` feature, and otherwise
+ * query again whenever the guard condition returned by rmw_node_get_graph_guard_condition()
+ * is triggered.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Runtime behavior
+ *   To query the ROS graph is a synchronous operation.
+ *   It is also non-blocking, but it is not guaranteed to be lock-free.
+ *   Implementations are expected to keep the generation in an atomic counter,
+ *   so that this query is much cheaper than any other graph query.
+ *
+ * \par Thread-safety
+ *   Nodes are thread-safe objects, and so are all operations on them except for finalization.
+ *   Therefore, it is safe to query the ROS graph using the same node concurrently.
+ *   However, access to primitive data-type arguments is not synchronized.
+ *   It is not safe to read or write `generation` while rmw_graph_get_generation() uses it.
+ *
+ * \pre Given `node` must be a valid node handle, as returned by rmw_create_node().
+ *
+ * \param[in] node Handle to node to use to query the ROS graph.
+ * \param[out] generation Current generation of the ROS graph.
+ * \return `RMW_RET_OK` if the query was successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `node` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `generation` is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `node` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unspecified error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_graph_get_generation(const rmw_node_t * node, uint64_t * generation);
+
+/// Retrieve the generation of the last change to the ROS graph involving a topic.
+/**
+ * This function returns the ROS graph generation, as returned by rmw_graph_get_generation(),
+ * produced by the last change involving the given topic: a publisher or subscription of the
+ * topic added or removed, or a type of the topic appearing or disappearing.
+ * It is 0 if the topic was never seen.
+ *
+ * Callers may thus cache the results of per-topic queries, e.g. rmw_count_publishers() or
+ * rmw_get_publishers_info_by_topic(), and skip them while changes are elsewhere in the graph.
+ *
+ * Implementations that do not track changes per topic may return the current generation
+ * of the whole ROS graph instead, which only causes spurious queries.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Runtime behavior
+ *   To query the ROS graph is a synchronous operation.
+ *   It is also non-blocking, but it is not guaranteed to be lock-free.
+ *   Generally speaking, implementations may synchronize access to internal resources using
+ *   locks but are not allowed to wait for events with no guaranteed time bound (barring
+ *   the effects of starvation due to OS scheduling).
+ *
+ * \par Thread-safety
+ *   Nodes are thread-safe objects, and so are all operations on them except for finalization.
+ *   Therefore, it is safe to query the ROS graph using the same node concurrently.
+ *   However, access to primitive data-type arguments is not synchronized.
+ *   It is not safe to read or write `topic_name` or `generation` while
+ *   rmw_graph_get_topic_generation() uses them.
+ *
+ * \pre Given `node` must be a valid node handle, as returned by rmw_create_node().
+ *
+ * \param[in] node Handle to node to use to query the ROS graph.
+ * \param[in] topic_name Fully qualified ROS topic name.
+ * \param[out] generation Generation of the last change involving the topic.
+ * \return `RMW_RET_OK` if the query was successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `node` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `topic_name` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `topic_name` is not a fully qualified topic name,
+ *   by rmw_validate_full_topic_name() definition, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `generation` is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `node` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unspecified error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_graph_get_topic_generation(
+  const rmw_node_t * node,
+  const char * topic_name,
+  uint64_t * generation);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__GRAPH_H_
@@ -0,0 +1,309 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__GRAPH_EVENTS_H_
+#define RMW__GRAPH_EVENTS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Kind of change to the ROS graph.
+typedef enum RMW_PUBLIC_TYPE rmw_graph_event_kind_e
+{
+  /// Event kind has not yet been set
+  RMW_GRAPH_EVENT_INVALID = 0,
+
+  /// A node was discovered
+  RMW_GRAPH_EVENT_NODE_ADDED,
+  /// A node went away
+  RMW_GRAPH_EVENT_NODE_REMOVED,
+
+  /// A publisher or subscription was discovered
+  RMW_GRAPH_EVENT_ENDPOINT_ADDED,
+  /// A publisher or subscription went away
+  RMW_GRAPH_EVENT_ENDPOINT_REMOVED,
+
+  /// A service server or client was discovered
+  RMW_GRAPH_EVENT_SERVICE_ENDPOINT_ADDED,
+  /// A service server or client went away
+  RMW_GRAPH_EVENT_SERVICE_ENDPOINT_REMOVED,
+
+  /// A topic name and type pair appeared in rmw_get_topic_names_and_types() results
+  RMW_GRAPH_EVENT_TOPIC_TYPE_ADDED,
+  /// A topic name and type pair disappeared from rmw_get_topic_names_and_types() results
+  RMW_GRAPH_EVENT_TOPIC_TYPE_REMOVED,
+
+  /// A service name and type pair appeared in rmw_get_service_names_and_types() results
+  RMW_GRAPH_EVENT_SERVICE_TYPE_ADDED,
+  /// A service name and type pair disappeared from rmw_get_service_names_and_types() results
+  RMW_GRAPH_EVENT_SERVICE_TYPE_REMOVED
+} rmw_graph_event_kind_t;
+
+/// A single change to the ROS graph.
+/**
+ * Strings are owned by the rmw implementation and valid until the context of the node
+ * the event was retrieved with is shut down, e.g. because they are interned in an
+ * rmw_string_table_t kept with the context, so events are cheap to produce and to keep.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_graph_event_s
+{
+  /// Graph generation this change produced.
+  uint64_t generation;
+  /// Kind of change.
+  rmw_graph_event_kind_t kind;
+  /// For endpoint events, whether the endpoint is a publisher or a subscription.
+  /// For service endpoint events, `RMW_ENDPOINT_SUBSCRIPTION` for servers and
+  /// `RMW_ENDPOINT_PUBLISHER` for clients.
+  /// `RMW_ENDPOINT_INVALID` otherwise.
+  rmw_endpoint_type_t endpoint_type;
+  /// Name of the node, NULL for topic and service type events.
+  const char * node_name;
+  /// Namespace of the node, NULL for topic and service type events.
+  const char * node_namespace;
+  /// Topic or service name, NULL for node events.
+  const char * name;
+  /// Topic or service type name, NULL for node events.
+  const char * type;
+  /// Global unique identifier of the endpoint, zeroed for node and type events.
+  uint8_t endpoint_gid[RMW_GID_STORAGE_SIZE];
+} rmw_graph_event_t;
+
+/// Array of changes to the ROS graph, in the order they happened.
+typedef struct RMW_PUBLIC_TYPE rmw_graph_event_array_s
+{
+  /// Size of the array.
+  size_t size;
+  /// Contiguous storage for graph events.
+  rmw_graph_event_t * events;
+  /// Graph generation after the last event, to retrieve the next events from.
+  uint64_t generation;
+  /// Whether events were discarded by the rmw implementation before they were retrieved.
+  /**
+   * If so, the array is empty, and callers must rebuild their view of the ROS graph
+   * with full queries, e.g. rmw_get_topic_names_and_types(), and then keep retrieving
+   * events from `generation`.
+   * Changes made while rebuilding are reported again by the next events, so events
+   * should be applied idempotently.
+   */
+  bool history_truncated;
+} rmw_graph_event_array_t;
+
+/// Return a zero initialized array of graph events.
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_graph_event_array_t
+rmw_get_zero_initialized_graph_event_array(void);
+
+/// Check that the given `graph_event_array` is zero initialized.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Access to the array of graph events is read-only, but it is not synchronized.
+ *   Concurrent `graph_event_array` reads are safe, but concurrent reads and writes are not.
+ *
+ * \param[in] graph_event_array Array to be checked.
+ * \returns `RMW_RET_OK` if array is zero initialized, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `graph_event_array` is NULL, or
+ * \returns `RMW_RET_ERROR` if `graph_event_array` is not zero initialized.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_graph_event_array_check_zero(const rmw_graph_event_array_t * graph_event_array);
+
+/// Initialize an array of graph events.
+/**
+ * This function allocates space to hold `size` zero initialized graph events.
+ * Both `events` and `size` members are updated accordingly.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Initialization is a reentrant procedure, but:
+ *   - Access to the array of graph events is not synchronized.
+ *     It is not safe to read or write `graph_event_array` during initialization.
+ *   - The default allocators are thread-safe objects, but any custom `allocator` may not be.
+ *     Check your allocator documentation for further reference.
+ *
+ * \param[inout] graph_event_array Array to be initialized on success,
+ *   but left unchanged on failure.
+ * \param[in] size Size of the array.
+ * \param[in] allocator Allocator to be used to populate `graph_event_array`.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `graph_event_array` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `graph_event_array` is not
+ *   a zero initialized array, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid,
+ *   by rcutils_allocator_is_valid() definition, or
+ * \returns `RMW_BAD_ALLOC` if memory allocation fails.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_graph_event_array_init_with_size(
+  rmw_graph_event_array_t * graph_event_array,
+  size_t size,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an array of graph events.
+/**
+ * This function deallocates the given array storage, and then zero initializes it.
+ * Event strings are owned by the rmw implementation, and are not deallocated.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Finalization is a reentrant procedure, but:
+ *   - Access to the array of graph events is not synchronized.
+ *     It is not safe to read or write `graph_event_array` during finalization.
+ *   - The default allocators are thread-safe objects, but any custom `allocator` may not be.
+ *     Check your allocator documentation for further reference.
+ *
+ * \pre Given `allocator` must be the same used to initialize the given `graph_event_array`.
+ *
+ * \param[inout] graph_event_array object to be finalized.
+ * \param[in] allocator Allocator used to populate the given `graph_event_array`.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `graph_event_array` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid,
+ *   by rcutils_allocator_is_valid() definition.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_graph_event_array_fini(
+  rmw_graph_event_array_t * graph_event_array,
+  rcutils_allocator_t * allocator);
+
+/// Retrieve the changes to the ROS graph since a given generation.
+/**
+ * The ROS graph generation is a counter the rmw implementation increments on every change
+ * to the graph discovered by the given node's context, starting from 0.
+ * This function returns the changes made after `since_generation`, in the order they
+ * happened, along with the current generation to retrieve the next changes from.
+ * Callers thus keep a view of the graph up to date with work proportional to the number
+ * of changes, instead of querying the whole graph again whenever the guard condition
+ * returned by rmw_node_get_graph_guard_condition() is triggered.
+ *
+ * To start, retrieve the current generation with rmw_graph_get_generation(), or by passing
+ * `UINT64_MAX` as `since_generation`, which returns no events, then build a view of the
+ * graph with full queries, and apply the events retrieved from that generation on.
+ *
+ * Depending on the RMW in use, discovery may be asynchronous, in which case events are
+ * reported as they are discovered.
+ * The rmw implementation may keep a bounded history of events, in which case events
+ * discarded before they could be retrieved are reported by
+ * `rmw_graph_event_array_t.history_truncated`.
+ *
+ * Callers should check the `RMW_FEATURE_GRAPH_EVENTS` feature, and otherwise
+ * query the whole graph.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Runtime behavior
+ *   To query the ROS graph is a synchronous operation.
+ *   It is also non-blocking, but it is not guaranteed to be lock-free.
+ *   Generally speaking, implementations may synchronize access to internal resources using
+ *   locks but are not allowed to wait for events with no guaranteed time bound (barring
+ *   the effects of starvation due to OS scheduling).
+ *
+ * \par Thread-safety
+ *   Nodes are thread-safe objects, and so are all operations on them except for finalization.
+ *   Therefore, it is safe to query the ROS graph using the same node concurrently.
+ *   However:
+ *   - Access to the array of graph events is not synchronized.
+ *     It is not safe to read or write `events` while rmw_get_graph_events() uses it.
+ *   - The default allocators are thread-safe objects, but any custom `allocator` may not be.
+ *     Check your allocator documentation for further reference.
+ *
+ * \pre Given `node` must be a valid node handle, as returned by rmw_create_node().
+ * \pre Given `events` must be a zero-initialized array of graph events,
+ *   as returned by rmw_get_zero_initialized_graph_event_array().
+ *
+ * \param[in] node Node to query the ROS graph.
+ * \param[in] since_generation Generation to retrieve changes after, usually
+ *   `rmw_graph_event_array_t.generation` as returned by the previous call.
+ * \param[in] allocator Allocator to be used when populating the `events` array.
+ * \param[out] events Array of graph events, populated on success,
+ *   left unchanged on failure.
+ *   If populated, it is up to the caller to finalize this array later on,
+ *   using rmw_graph_event_array_fini().
+ * \return `RMW_RET_OK` if the query was successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `node` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is not valid,
+ *   by rcutils_allocator_is_valid() definition, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `events` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `events` is not a zero-initialized array, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `node` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unspecified error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_graph_events(
+  const rmw_node_t * node,
+  uint64_t since_generation,
+  rcutils_allocator_t * allocator,
+  rmw_graph_event_array_t * events);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__GRAPH_EVENTS_H_
@@ -0,0 +1,198 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__IMPL__CPP__VALIDATE_NAMES_HPP_
+#define RMW__IMPL__CPP__VALIDATE_NAMES_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+#include "rmw/validate_full_topic_name.h"
+#include "rmw/validate_namespace.h"
+#include "rmw/validate_node_name.h"
+
+namespace rmw
+{
+namespace impl
+{
+namespace cpp
+{
+
+/// Outcome of a name validation, as the rmw_validate_*() functions report it.
+struct NameValidation
+{
+  /// One of the `RMW_TOPIC_*`, `RMW_NODE_NAME_*` or `RMW_NAMESPACE_*` results, as validated.
+  int validation_result;
+  /// Index of the name where an error occurred, or 0 if it is valid.
+  std::size_t invalid_index;
+};
+
+namespace detail
+{
+
+constexpr bool
+is_digit(char c) noexcept
+{
+  return c >= '0' && c <= '9';
+}
+
+// As rcutils_isalnum_no_locale(), plus '_'.
+constexpr bool
+is_word(char c) noexcept
+{
+  return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+// The rules shared by topic names and namespaces, all but their length limit.
+constexpr NameValidation
+check_absolute_name(std::string_view name) noexcept
+{
+  if (name.empty()) {
+    return {RMW_TOPIC_INVALID_IS_EMPTY_STRING, 0u};
+  }
+  if (name.front() != '/') {
+    return {RMW_TOPIC_INVALID_NOT_ABSOLUTE, 0u};
+  }
+  if (name.back() == '/') {
+    return {RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH, name.size() - 1u};
+  }
+  for (std::size_t i = 0u; i < name.size(); ++i) {
+    if (!is_word(name[i]) && name[i] != '/') {
+      return {RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS, i};
+    }
+  }
+  for (std::size_t i = 1u; i < name.size(); ++i) {
+    if (name[i - 1u] == '/') {
+      if (name[i] == '/') {
+        return {RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH, i};
+      }
+      if (is_digit(name[i])) {
+        return {RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, i};
+      }
+    }
+  }
+  return {RMW_TOPIC_VALID, 0u};
+}
+
+}  // namespace detail
+
+/// Determine if a given fully qualified topic name is valid, at compile time if need be.
+/**
+ * This follows the rules, and gives the results and invalid indices of,
+ * rmw_validate_full_topic_name_with_size(), so that names known at compile time can be checked
+ * with `static_assert` rather than on every run, e.g.:
+ *
+ * ```cpp
+ * static_assert(rmw::impl::cpp::is_valid_full_topic_name("/chatter"));
+ * ```
+ *
+ * \param[in] topic_name topic name to be validated
+ * \return the result of the validation, with an invalid index of 0 if it is `RMW_TOPIC_VALID`.
+ */
+constexpr NameValidation
+validate_full_topic_name(std::string_view topic_name) noexcept
+{
+  const NameValidation validation = detail::check_absolute_name(topic_name);
+  if (validation.validation_result != RMW_TOPIC_VALID) {
+    return validation;
+  }
+  if (topic_name.size() > RMW_TOPIC_MAX_NAME_LENGTH) {
+    return {RMW_TOPIC_INVALID_TOO_LONG, RMW_TOPIC_MAX_NAME_LENGTH - 1u};
+  }
+  return validation;
+}
+
+/// Determine if a given node name is valid, at compile time if need be.
+/**
+ * This follows the rules, and gives the results and invalid indices of,
+ * rmw_validate_node_name_with_size().
+ *
+ * \sa validate_full_topic_name(std::string_view)
+ *
+ * \param[in] node_name node name to be validated
+ * \return the result of the validation, with an invalid index of 0 if it is `RMW_NODE_NAME_VALID`.
+ */
+constexpr NameValidation
+validate_node_name(std::string_view node_name) noexcept
+{
+  if (node_name.empty()) {
+    return {RMW_NODE_NAME_INVALID_IS_EMPTY_STRING, 0u};
+  }
+  for (std::size_t i = 0u; i < node_name.size(); ++i) {
+    if (!detail::is_word(node_name[i])) {
+      return {RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS, i};
+    }
+  }
+  if (detail::is_digit(node_name.front())) {
+    return {RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER, 0u};
+  }
+  if (node_name.size() > RMW_NODE_NAME_MAX_NAME_LENGTH) {
+    return {RMW_NODE_NAME_INVALID_TOO_LONG, RMW_NODE_NAME_MAX_NAME_LENGTH - 1u};
+  }
+  return {RMW_NODE_NAME_VALID, 0u};
+}
+
+/// Determine if a given namespace is valid, at compile time if need be.
+/**
+ * This follows the rules, and gives the results and invalid indices of,
+ * rmw_validate_namespace_with_size().
+ *
+ * \sa validate_full_topic_name(std::string_view)
+ *
+ * \param[in] namespace_ namespace to be validated
+ * \return the result of the validation, with an invalid index of 0 if it is `RMW_NAMESPACE_VALID`.
+ */
+constexpr NameValidation
+validate_namespace(std::string_view namespace_) noexcept
+{
+  if (namespace_ == "/") {
+    return {RMW_NAMESPACE_VALID, 0u};
+  }
+  // namespace results have the values of their topic counterparts
+  const NameValidation validation = detail::check_absolute_name(namespace_);
+  if (validation.validation_result != RMW_NAMESPACE_VALID) {
+    return validation;
+  }
+  if (namespace_.size() > RMW_NAMESPACE_MAX_LENGTH) {
+    return {RMW_NAMESPACE_INVALID_TOO_LONG, RMW_NAMESPACE_MAX_LENGTH - 1u};
+  }
+  return validation;
+}
+
+/// Return `true` if the topic name is `RMW_TOPIC_VALID`, which is not the case if it is too long.
+constexpr bool
+is_valid_full_topic_name(std::string_view topic_name) noexcept
+{
+  return validate_full_topic_name(topic_name).validation_result == RMW_TOPIC_VALID;
+}
+
+/// Return `true` if the node name is `RMW_NODE_NAME_VALID`, which is not the case if too long.
+constexpr bool
+is_valid_node_name(std::string_view node_name) noexcept
+{
+  return validate_node_name(node_name).validation_result == RMW_NODE_NAME_VALID;
+}
+
+/// Return `true` if the namespace is `RMW_NAMESPACE_VALID`, which is not the case if too long.
+constexpr bool
+is_valid_namespace(std::string_view namespace_) noexcept
+{
+  return validate_namespace(namespace_).validation_result == RMW_NAMESPACE_VALID;
+}
+
+}  // namespace cpp
+}  // namespace impl
+}  // namespace rmw
+
+#endif  // RMW__IMPL__CPP__VALIDATE_NAMES_HPP_
@@ -25,6 +25,7 @@ extern "C"
 #include "rcutils/allocator.h"
 #include "rmw/discovery_options.h"
 #include "rmw/domain_id.h"
+#include "rmw/entity_pool.h"
 #include "rmw/macros.h"
 #include "rmw/ret_types.h"
 #include "rmw/security_options.h"
@@ -56,6 +57,13 @@ typedef struct RMW_PUBLIC_TYPE rmw_init_options_s
   rmw_discovery_options_t discovery_options;
   /// Enclave, name used to find security artifacts in a sros2 keystore.
   char * enclave;
+  /// Capacities of the entity pools to preallocate.
+  /**
+   * Implementations should pass these to `rmw_entity_pools_init()` during `rmw_init()`,
+   * and release them with `rmw_entity_pools_fini()` during `rmw_context_fini()`.
+   * Zero initialized by default, leaving all pools disabled.
+   */
+  rmw_entity_pool_options_t entity_pool_options;
 
   // TODO(wjwwood): replace with rmw_allocator_t when that refactor happens
   /// Allocator used during internal allocation of init options, if needed.
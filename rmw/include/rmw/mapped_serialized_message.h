@@ -0,0 +1,208 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__MAPPED_SERIALIZED_MESSAGE_H_
+#define RMW__MAPPED_SERIALIZED_MESSAGE_H_
+
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/serialized_message.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Implementation of a mapped serialized message, opaque to users.
+typedef struct rmw_mapped_serialized_message_impl_s rmw_mapped_serialized_message_impl_t;
+
+/// Serialized message whose buffer is a shared memory mapping of a file or an anonymous memfd.
+/**
+ * The buffer of `serialized_message` is the mapping itself, so that the payload can be
+ * handed to another process, or written to disk, through the file descriptor without being
+ * copied through user space buffers.
+ *
+ * `serialized_message` is initialized with an allocator adapter over the file, see
+ * rmw_mapped_serialized_message_get_allocator(), so it can be used, resized and passed around
+ * like any other serialized message.
+ * Resizing it resizes the file, and may move the mapping, except for files received with
+ * rmw_mapped_serialized_message_init_from_fd(), which are never resized.
+ *
+ * Only supported on POSIX systems, initialization returns `RMW_RET_UNSUPPORTED` elsewhere.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_mapped_serialized_message_s
+{
+  /// Serialized message backed by the mapping.
+  rmw_serialized_message_t serialized_message;
+  /// Implementation of the mapping.
+  rmw_mapped_serialized_message_impl_t * impl;
+} rmw_mapped_serialized_message_t;
+
+/// Return an rmw_mapped_serialized_message_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_mapped_serialized_message_t
+rmw_get_zero_initialized_mapped_serialized_message(void);
+
+/// Initialize a mapped serialized message backed by a new file.
+/**
+ * The file is created if it does not exist, and truncated otherwise.
+ * If `path` is NULL, an anonymous in-memory file is used instead, i.e. a memfd where
+ * available, or an unlinked POSIX shared memory object.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] mapped zero initialized mapped serialized message to be initialized.
+ * \param[in] path path of the file to map, or NULL for an anonymous in-memory file.
+ * \param[in] capacity initial capacity of the serialized message, in bytes. May be zero.
+ * \param[in] allocator the allocator used for bookkeeping.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `mapped` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation, resizing the file or mapping it fails, or
+ * \return `RMW_RET_UNSUPPORTED` if memory mapped files are not supported on this platform, or
+ * \return `RMW_RET_ERROR` if the file cannot be created.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_init(
+  rmw_mapped_serialized_message_t * mapped,
+  const char * path,
+  size_t capacity,
+  const rcutils_allocator_t * allocator);
+
+/// Initialize a mapped serialized message from an existing file descriptor.
+/**
+ * This is how a process maps a payload it was handed by another process.
+ * `fd` is duplicated, so the caller keeps ownership of it.
+ * The first `length` bytes of the file are mapped, and make up the serialized message.
+ * If `fd` is open for reading and writing, the serialized message may be modified in
+ * place.
+ * If `fd` is read-only, as payloads received from another process often are, the file
+ * is mapped read-only, and the buffer must not be written to.
+ * Either way, the file is never resized, since other processes may have it mapped:
+ * resizing the serialized message fails, and leaves it unchanged.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] mapped zero initialized mapped serialized message to be initialized.
+ * \param[in] fd file descriptor of a file opened for reading, and optionally writing.
+ * \param[in] length number of bytes of the serialized message, at most the file size.
+ * \param[in] allocator the allocator used for bookkeeping.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `mapped` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `fd` is negative, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `fd` is not open for reading, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `length` is larger than the file, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation or mapping fails, or
+ * \return `RMW_RET_UNSUPPORTED` if memory mapped files are not supported on this platform, or
+ * \return `RMW_RET_ERROR` if `fd` cannot be duplicated or inspected.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_init_from_fd(
+  rmw_mapped_serialized_message_t * mapped,
+  int fd,
+  size_t length,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a mapped serialized message.
+/**
+ * The mapping is removed and the file descriptor closed.
+ * Files created from a path are left on disk, with the size of the serialized message
+ * capacity.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] mapped mapped serialized message to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `mapped` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_fini(rmw_mapped_serialized_message_t * mapped);
+
+/// Get the file descriptor backing a mapped serialized message.
+/**
+ * The file holds the `serialized_message.buffer_capacity` bytes of the buffer, of which the
+ * first `serialized_message.buffer_length` make up the message.
+ * The receiving process needs that length alongside the file descriptor.
+ *
+ * The file descriptor remains owned by `mapped`, and is only valid as long as it is.
+ *
+ * \param[in] mapped mapped serialized message to inspect.
+ * \param[out] fd the file descriptor.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `mapped` or `fd` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `mapped` is not initialized.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_get_fd(
+  const rmw_mapped_serialized_message_t * mapped,
+  int * fd);
+
+/// Get the allocator adapter over the file backing a mapped serialized message.
+/**
+ * Allocating from it maps the file, after resizing it to the requested size, reallocating
+ * resizes the file and remaps it, and deallocating unmaps it.
+ * The file holds a single buffer, so allocating again while a buffer is mapped fails.
+ * Allocating and reallocating always fail for files received with
+ * rmw_mapped_serialized_message_init_from_fd().
+ *
+ * `serialized_message` already uses it; it is exposed so that another serialized message
+ * can be initialized over the same file once `serialized_message` is finalized, e.g. with
+ * rmw_serialized_message_init().
+ *
+ * \param[in] mapped mapped serialized message to get the allocator of.
+ * \return an allocator over the file, or
+ * \return a zero initialized, thus invalid, allocator if `mapped` is NULL or not initialized.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rcutils_allocator_t
+rmw_mapped_serialized_message_get_allocator(const rmw_mapped_serialized_message_t * mapped);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__MAPPED_SERIALIZED_MESSAGE_H_
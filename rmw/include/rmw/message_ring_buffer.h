@@ -0,0 +1,185 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__MESSAGE_RING_BUFFER_H_
+#define RMW__MESSAGE_RING_BUFFER_H_
+
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Structure to hold a first-in first-out sequence of ROS messages in a ring buffer.
+/**
+ * Like `rmw_message_sequence_t`, it holds pointers to messages and does not own them.
+ * Entries wrap around the end of `data`, so the oldest entry is at `data[head]`
+ * and the i-th oldest at `data[(head + i) % capacity]`, see `rmw_message_ring_buffer_at()`.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_message_ring_buffer_s
+{
+  /// Circular array of pointers to ROS messages.
+  void ** data;
+  /// Index in `data` of the oldest entry.
+  size_t head;
+  /// The number of valid entries.
+  size_t size;
+  /// The total allocated capacity of the data array.
+  size_t capacity;
+  /// Capacity below which the data array is never shrunk.
+  size_t reserved;
+  /// The allocator used to allocate the data array.
+  rcutils_allocator_t * allocator;
+} rmw_message_ring_buffer_t;
+
+/// Return an rmw_message_ring_buffer_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_message_ring_buffer_t
+rmw_get_zero_initialized_message_ring_buffer(void);
+
+/// Initialize an rmw_message_ring_buffer_t object.
+/**
+ * \param[inout] ring_buffer ring buffer object to be initialized.
+ * \param[in] capacity capacity to be reserved, see `rmw_message_ring_buffer_reserve()`.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_init(
+  rmw_message_ring_buffer_t * ring_buffer,
+  size_t capacity,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_message_ring_buffer_t object.
+/**
+ * Note: This will not call `fini` or deallocate the underlying message structures.
+ *
+ * \param[inout] ring_buffer ring buffer object to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the ring buffer allocator is invalid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_fini(rmw_message_ring_buffer_t * ring_buffer);
+
+/// Drop all entries, keeping the allocated capacity.
+/**
+ * \param[inout] ring_buffer ring buffer to be emptied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_reset(rmw_message_ring_buffer_t * ring_buffer);
+
+/// Make room for at least `capacity` entries, and never shrink below that.
+/**
+ * Pushing up to `capacity` entries after this call does not allocate.
+ *
+ * \param[inout] ring_buffer ring buffer to be grown.
+ * \param[in] capacity number of entries to make room for.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the ring buffer allocator is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, leaving `ring_buffer` unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_reserve(rmw_message_ring_buffer_t * ring_buffer, size_t capacity);
+
+/// Append a message as the newest entry, growing the ring buffer if it is full.
+/**
+ * Capacity is doubled whenever it runs out, so pushes are amortized O(1).
+ *
+ * \param[inout] ring_buffer ring buffer to push into.
+ * \param[in] message message to be appended.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the ring buffer allocator is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, leaving `ring_buffer` unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_push(rmw_message_ring_buffer_t * ring_buffer, void * message);
+
+/// Append a message as the newest entry, evicting the oldest one if the ring buffer is full.
+/**
+ * This never allocates, which keeps a sliding window over the last `capacity` messages.
+ *
+ * \param[inout] ring_buffer ring buffer to push into.
+ * \param[in] message message to be appended.
+ * \param[out] evicted the evicted message, or `NULL` if none was. May be NULL.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` has no capacity.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_push_overwrite(
+  rmw_message_ring_buffer_t * ring_buffer,
+  void * message,
+  void ** evicted);
+
+/// Remove the oldest entry.
+/**
+ * Once no more than a quarter of the capacity is in use, the data array is
+ * halved, though never below the reserved capacity, so pops are amortized O(1).
+ * A failure to shrink is not an error.
+ *
+ * \param[inout] ring_buffer ring buffer to pop from.
+ * \param[out] message the removed message.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ring_buffer` or `message` is NULL, or
+ * \return `RMW_RET_ERROR` if `ring_buffer` is empty.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_ring_buffer_pop(rmw_message_ring_buffer_t * ring_buffer, void ** message);
+
+/// Get the i-th oldest entry.
+/**
+ * \param[in] ring_buffer ring buffer to read from.
+ * \param[in] index position of the entry, zero being the oldest.
+ * \return the message at that position, or
+ * \return `NULL` if `ring_buffer` is NULL or `index` is out of range.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+void *
+rmw_message_ring_buffer_at(const rmw_message_ring_buffer_t * ring_buffer, size_t index);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__MESSAGE_RING_BUFFER_H_
@@ -111,10 +111,94 @@ rmw_names_and_types_init(
   size_t size,
   rcutils_allocator_t * allocator);
 
+/// Initialize an array of names and types in a single memory block.
+/**
+ * This function allocates a single block holding the string array for the names,
+ * the zero initialized string arrays for the types, and an arena of `arena_size` bytes.
+ * The allocator of the names string array is set to a bump allocator drawing from that
+ * arena, so the string arrays for each set of types and all names and type names can be
+ * populated with the usual functions, e.g. rcutils_string_array_init() and
+ * rcutils_strdup(), passing `names_and_types->names.allocator` to them.
+ * Nothing else is allocated while populating the array, and rmw_names_and_types_fini()
+ * deallocates it all at once.
+ *
+ * The bump allocator rounds every allocation up to a multiple of `sizeof(void *)`.
+ * Allocation fails once the arena is exhausted.
+ * Deallocation only reclaims memory if it is the last allocation, and reallocation only
+ * succeeds for the last allocation, otherwise both leave the arena unchanged.
+ * Use rmw_names_and_types_get_arena_size() to compute a suitable `arena_size`.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Initialization is a reentrant procedure, but:
+ *   - Access to arrays of names and types is not synchronized.
+ *     It is not safe to read or write `names_and_types` during initialization.
+ *   - The bump allocator is not thread-safe, so the array must be populated by one
+ *     thread at a time.
+ *   - The default allocators are thread-safe objects, but any custom `allocator` may not be.
+ *     Check your allocator documentation for further reference.
+ *
+ * \param[inout] names_and_types Array to be initialized on success,
+ *   but left unchanged on failure.
+ * \param[in] size Size of the array.
+ * \param[in] arena_size Size in bytes of the arena for type arrays and strings.
+ * \param[in] allocator Allocator to be used to allocate the memory block.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `names_and_types` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `names_and_types` is not
+ *   a zero initialized array, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid,
+ *   by rcutils_allocator_is_valid() definition, or
+ * \returns `RMW_BAD_ALLOC` if the memory block size overflows, or
+ * \returns `RMW_BAD_ALLOC` if memory allocation fails.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_names_and_types_init_with_arena(
+  rmw_names_and_types_t * names_and_types,
+  size_t size,
+  size_t arena_size,
+  rcutils_allocator_t * allocator);
+
+/// Compute the arena size needed to populate an array of names and types.
+/**
+ * The result is enough for rmw_names_and_types_init_with_arena() to hold the string
+ * arrays for each set of types and a copy of each name and type name.
+ *
+ * \param[in] size Number of names.
+ * \param[in] types_count Total number of type names, across all names.
+ * \param[in] strings_length Total length of all names and type names,
+ *   excluding their null terminators.
+ * \param[out] arena_size Size in bytes of the arena.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `arena_size` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if the arena size overflows.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_names_and_types_get_arena_size(
+  size_t size,
+  size_t types_count,
+  size_t strings_length,
+  size_t * arena_size);
+
 /// Finalize an array of names and types.
 /**
  * This function deallocates the string array of names and the array of string arrays of types,
  * and zero initializes the given array.
+ * If the array was initialized by rmw_names_and_types_init_with_arena(), its memory block
+ * is deallocated at once instead.
  * If a logical error, such as `RMW_RET_INVALID_ARGUMENT`, ensues, this function will return
  * early, leaving the given array unchanged.
  * Otherwise, it will proceed despite errors.
@@ -106,6 +106,8 @@ extern "C"
 #include "rmw/message_sequence.h"
 #include "rmw/publisher_options.h"
 #include "rmw/qos_profiles.h"
+#include "rmw/serialized_message_iov.h"
+#include "rmw/serialized_message_sequence.h"
 #include "rmw/dynamic_message_type_support.h"
 #include "rmw/subscription_options.h"
 #include "rmw/types.h"
@@ -548,6 +550,93 @@ rmw_publish(
   const void * ros_message,
   rmw_publisher_allocation_t * allocation);
 
+/// Publish a sequence of ROS messages.
+/**
+ * Send all ROS messages in the given sequence, in order, to all subscriptions with matching
+ * QoS policies using the given publisher.
+ * Subscriptions receive them as if rmw_publish() had been called once per ROS message, but
+ * implementations are free to coalesce them, e.g. into a single transport send.
+ * Callers should check the `RMW_FEATURE_PUBLISH_SEQUENCE` feature, and fall back to
+ * rmw_publish() if it is not supported.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ *
+ * <i>[1] implementation defined, check implementation documentation.</i>
+ *
+ * \par Runtime behavior
+ *   Same as rmw_publish(), for the whole sequence.
+ *   Asynchronous implementations are not allowed to access any of the given ROS messages
+ *   after this function returns.
+ *
+ * \par Partial failure
+ *   ROS messages are published in sequence order, and publication stops at the first
+ *   ROS message that fails to be published.
+ *   On return, `published` holds the number of ROS messages that were published, all of
+ *   them taken from the front of the sequence: messages `[0, published)` were published
+ *   and messages `[published, size)` were not, not even partially.
+ *   Implementations that coalesce ROS messages must uphold this, e.g. by flushing what was
+ *   already serialized before reporting an error.
+ *   Retrying with the remaining messages is thus safe and does not lead to duplicates.
+ *
+ * \par Memory allocation
+ *   Same as rmw_publish().
+ *   A publisher allocation, if provided, may or may not be used, and is reused across all
+ *   ROS messages in the sequence.
+ *
+ * \par Thread-safety
+ *   Publishers are thread-safe objects, and so are all operations on them except for finalization.
+ *   Therefore, it is safe to publish using the same publisher concurrently.
+ *   However, ROS messages from a concurrent publish may be interleaved with those of the
+ *   sequence, and when publishing a sequence of ROS messages:
+ *   - Access to the ROS message sequence is read-only but it is not synchronized.
+ *     Concurrent `message_sequence` reads are safe, but concurrent reads and writes are not.
+ *   - Access to given primitive data-type arguments is not synchronized.
+ *     It is not safe to read or write `published` while rmw_publish_sequence() uses it.
+ *   - Access to the publisher allocation is not synchronized, unless specifically stated
+ *     otherwise by the implementation.
+ *     Thus, it is generally not safe to read or write `allocation` while
+ *     rmw_publish_sequence() uses it.
+ *
+ * \pre Given `publisher` must be a valid publisher, as returned by rmw_create_publisher().
+ * \pre Given `message_sequence` must be a valid message sequence, initialized by
+ *   rmw_message_sequence_init(), whose first `size` entries are valid messages whose type
+ *   matches the message type support the `publisher` was registered with on creation.
+ * \pre If not NULL, given `allocation` must be a valid publisher allocation, initialized
+ *   with rmw_publisher_allocation_init() with a message type support that matches the
+ *   one registered with `publisher` on creation.
+ *
+ * \param[in] publisher Publisher to be used to send messages.
+ * \param[in] message_sequence Sequence of type erased ROS messages to be sent.
+ *   An empty sequence publishes nothing and succeeds.
+ * \param[out] published Number of messages actually published.
+ * \param[in] allocation Pre-allocated memory to be used. May be NULL.
+ * \return `RMW_RET_OK` if all messages were published, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `publisher` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message_sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `published` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any of the first `size` entries of
+ *   `message_sequence` is NULL, in which case nothing is published, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if `publisher` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if the implementation does not support publishing sequences,
+ *   in which case nothing is published, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs, see partial failure above.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_publish_sequence(
+  const rmw_publisher_t * publisher,
+  const rmw_message_sequence_t * message_sequence,
+  size_t * published,
+  rmw_publisher_allocation_t * allocation);
+
 /// Publish a loaned ROS message.
 /**
  * Send a previously borrowed ROS message to all subscriptions with matching QoS policies
@@ -754,6 +843,133 @@ rmw_publish_serialized_message(
   const rmw_serialized_message_t * serialized_message,
   rmw_publisher_allocation_t * allocation);
 
+/// Publish a sequence of ROS messages as byte streams.
+/**
+ * Same as rmw_publish_serialized_message(), for every serialized ROS message in the given
+ * sequence, in order.
+ * Implementations are free to coalesce them, e.g. into a single transport send.
+ * Callers should check the `RMW_FEATURE_SERIALIZED_SEQUENCE` feature, and fall back to
+ * rmw_publish_serialized_message() if it is not supported.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ *
+ * <i>[1] implementation defined, check the implementation documentation.</i>
+ *
+ * \par Partial failure
+ *   Same as rmw_publish_sequence(): on return, serialized ROS messages `[0, published)`
+ *   were published and the remaining ones were not, not even partially.
+ *
+ * \par Thread-safety
+ *   Publishers are thread-safe objects, and so are all operations on them except for finalization.
+ *   Therefore, it is safe to publish using the same publisher concurrently.
+ *   However, when publishing a sequence of serialized ROS messages:
+ *   - Access to the sequence is read-only but it is not synchronized.
+ *     Concurrent `serialized_message_sequence` reads are safe, but concurrent reads and
+ *     writes are not.
+ *   - Access to given primitive data-type arguments is not synchronized.
+ *     It is not safe to read or write `published` while rmw_publish_serialized_sequence()
+ *     uses it.
+ *   - Access to the publisher allocation is not synchronized, unless specifically stated
+ *     otherwise by the implementation.
+ *     Thus, it is generally not safe to read or write `allocation` while
+ *     rmw_publish_serialized_sequence() uses it.
+ *
+ * \pre Given `publisher` must be a valid publisher, as returned by rmw_create_publisher().
+ * \pre Given `serialized_message_sequence` must be a valid sequence, initialized by
+ *   rmw_serialized_message_sequence_init() and holding serializations of ROS messages whose
+ *   type matches the message type support the `publisher` was registered with on creation.
+ * \pre If not NULL, given `allocation` must be a valid publisher allocation, initialized
+ *   with rmw_publisher_allocation_init() with a message type support that matches the
+ *   one registered with `publisher` on creation.
+ *
+ * \param[in] publisher Publisher to be used to send messages.
+ * \param[in] serialized_message_sequence Serialized ROS messages to be sent.
+ *   An empty sequence publishes nothing and succeeds.
+ * \param[out] published Number of serialized messages actually published.
+ * \param[in] allocation Pre-allocated memory to be used. May be NULL.
+ * \return `RMW_RET_OK` if all serialized messages were published, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `publisher` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `serialized_message_sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `published` is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if `publisher` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if the implementation does not support publishing sequences,
+ *   in which case nothing is published, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs, see partial failure above.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_publish_serialized_sequence(
+  const rmw_publisher_t * publisher,
+  const rmw_serialized_message_sequence_t * serialized_message_sequence,
+  size_t * published,
+  rmw_publisher_allocation_t * allocation);
+
+/// Publish a ROS message as a byte stream split into segments.
+/**
+ * Same as rmw_publish_serialized_message(), except that the byte stream is the
+ * concatenation of the segments of `serialized_message`, which do not have to be
+ * contiguous in memory, e.g. a header followed by a large payload.
+ * Implementations may hand the segments over to the transport as is, e.g. with `sendmsg`,
+ * instead of copying them into a single buffer first.
+ * Callers should check the `RMW_FEATURE_SERIALIZED_MESSAGE_IOV` feature, and otherwise use
+ * rmw_serialized_message_iov_gather() and rmw_publish_serialized_message().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ *
+ * <i>[1] implementation defined, check the implementation documentation.</i>
+ *
+ * \par Runtime behavior
+ *   Same as rmw_publish_serialized_message().
+ *   Asynchronous implementations are not allowed to access the segments, nor the bytes
+ *   they point to, after this function returns.
+ *
+ * \par Thread-safety
+ *   Same as rmw_publish_serialized_message(): access to the segments and the bytes they
+ *   point to is read-only but it is not synchronized.
+ *
+ * \pre Given `publisher` must be a valid publisher, as returned by rmw_create_publisher().
+ * \pre Given `serialized_message` must be a valid segmented serialized message, initialized
+ *   by rmw_serialized_message_iov_init(), whose concatenated segments are the serialization
+ *   of a ROS message whose type matches the message type support the `publisher` was
+ *   registered with on creation.
+ * \pre If not NULL, given `allocation` must be a valid publisher allocation, initialized
+ *   with rmw_publisher_allocation_init() with a message type support that matches the
+ *   one registered with `publisher` on creation.
+ *
+ * \param[in] publisher Publisher to be used to send message.
+ * \param[in] serialized_message Segmented serialized ROS message to be sent.
+ * \param[in] allocation Pre-allocated memory to be used. May be NULL.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `publisher` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `serialized_message` is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if `publisher` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if the implementation does not support segmented
+ *   serialized messages, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_publish_serialized_message_iov(
+  const rmw_publisher_t * publisher,
+  const rmw_serialized_message_iov_t * serialized_message,
+  rmw_publisher_allocation_t * allocation);
+
 /// Compute the size of a serialized message.
 /**
  * Given a message definition and bounds, compute the serialized size.
@@ -882,6 +1098,95 @@ rmw_serialize(
   const rosidl_message_type_support_t * type_support,
   rmw_serialized_message_t * serialized_message);
 
+/// Compute the exact size of the serialization of a ROS message.
+/**
+ * Unlike rmw_get_serialized_message_size(), which bounds the size of any ROS message of
+ * a type, this computes the number of bytes rmw_serialize() and rmw_serialize_into() output
+ * for the given ROS message instance, unbounded fields included.
+ * Callers should check the `RMW_FEATURE_SERIALIZE_INTO` feature, and otherwise use
+ * rmw_serialize().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \pre Given ROS message must be a valid non-null instance, initialized
+ *   by the caller and matching the provided typesupport.
+ * \pre Given typesupport must be a valid non-null instance, as provided
+ *   by `rosidl` APIs.
+ *
+ * \param[in] ros_message the typed ROS message
+ * \param[in] type_support the typesupport for the ROS message
+ * \param[out] size the exact size of the serialization, in bytes
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_serialized_size(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_support,
+  size_t * size);
+
+/// Serialize a ROS message into a caller owned buffer.
+/**
+ * The ROS message is serialized into the first bytes of `buffer`, as rmw_serialize()
+ * would, except that the buffer is never reallocated: if the serialization does not fit,
+ * serialization fails instead.
+ * Together with rmw_get_serialized_size(), this lets callers serialize into preallocated
+ * memory, e.g. an arena or a mapped serialized message, without any allocation.
+ * Callers should check the `RMW_FEATURE_SERIALIZE_INTO` feature, and otherwise use
+ * rmw_serialize().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Buffer too small
+ *   If `buffer_capacity` is smaller than the serialization, `RMW_RET_INVALID_ARGUMENT` is
+ *   returned, `serialized_size` is set to the size it takes, and the contents of `buffer`
+ *   are unspecified.
+ *   Nothing is ever written past `buffer_capacity` bytes.
+ *
+ * \pre Given ROS message must be a valid non-null instance, initialized
+ *   by the caller and matching the provided typesupport.
+ * \pre Given typesupport must be a valid non-null instance, as provided
+ *   by `rosidl` APIs.
+ *
+ * \param[in] ros_message the typed ROS message
+ * \param[in] type_support the typesupport for the ROS message
+ * \param[out] buffer the destination for the serialized ROS message
+ * \param[in] buffer_capacity number of bytes available in `buffer`
+ * \param[out] serialized_size number of bytes of the serialization
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `buffer_capacity` is too small, see above, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialize_into(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_support,
+  uint8_t * buffer,
+  size_t buffer_capacity,
+  size_t * serialized_size);
+
 /// Deserialize a ROS message.
 /**
  * The given rmw_serialized_message_t's internal byte stream buffer is deserialized
@@ -922,6 +1227,118 @@ rmw_deserialize(
   const rosidl_message_type_support_t * type_support,
   void * ros_message);
 
+/// Serialize a sequence of ROS messages of the same type.
+/**
+ * Same as rmw_serialize(), for all ROS messages in the given sequence at once, whose byte
+ * streams are appended in order to the given serialized message sequence.
+ * The type support is resolved once for the whole sequence, and implementations are free
+ * to serialize ROS messages concurrently, e.g. on a thread pool for large sequences.
+ * Callers should check the `RMW_FEATURE_SERIALIZE_SEQUENCE` feature, and fall back to
+ * rmw_serialize() if it is not supported.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Maybe [2]
+ * Lock-Free          | Maybe [2]
+ * <i>[1] if the serialized message sequence does not have enough capacity to hold
+ *        the ROS message serializations</i>
+ * <i>[2] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Partial failure
+ *   On return, `serialized_count` holds the number of ROS messages whose serialization was
+ *   appended, all of them taken from the front of the sequence: messages
+ *   `[0, serialized_count)` were serialized and messages `[serialized_count, size)` were
+ *   not, and no partial serialization is left in `serialized_message_sequence`.
+ *
+ * \pre Given `ros_messages` must be a valid message sequence, initialized by
+ *   rmw_message_sequence_init(), whose first `size` entries are valid ROS messages
+ *   matching the provided typesupport.
+ * \pre Given typesupport must be a valid non-null instance, as provided
+ *   by `rosidl` APIs.
+ * \pre Given `serialized_message_sequence` must be a valid sequence, initialized by
+ *   rmw_serialized_message_sequence_init().
+ *
+ * \param[in] ros_messages the typed ROS messages
+ * \param[in] type_support the typesupport for all ROS messages
+ * \param[inout] serialized_message_sequence the sequence to append the byte streams to.
+ *   It is not reset first.
+ * \param[out] serialized_count number of ROS messages actually serialized
+ * \return `RMW_RET_OK` if all ROS messages were serialized, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, in which case nothing
+ *   is serialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation failed, see partial failure above, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs, see partial failure above.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialize_sequence(
+  const rmw_message_sequence_t * ros_messages,
+  const rosidl_message_type_support_t * type_support,
+  rmw_serialized_message_sequence_t * serialized_message_sequence,
+  size_t * serialized_count);
+
+/// Deserialize a sequence of ROS messages of the same type.
+/**
+ * Same as rmw_deserialize(), for all byte streams in the given serialized message sequence
+ * at once, the i-th of which is deserialized into the i-th entry of `ros_messages`.
+ * The type support is resolved once for the whole sequence, and implementations are free
+ * to deserialize ROS messages concurrently, e.g. on a thread pool for large sequences.
+ * Callers should check the `RMW_FEATURE_SERIALIZE_SEQUENCE` feature, and fall back to
+ * rmw_deserialize() if it is not supported.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Maybe [2]
+ * Lock-Free          | Maybe [2]
+ * <i>[1] if the given ROS messages contain unbounded fields</i>
+ * <i>[2] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \par Partial failure
+ *   On return, `deserialized_count` holds the number of ROS messages deserialized, all of
+ *   them from the front of the sequence: entries `[0, deserialized_count)` of
+ *   `ros_messages` hold deserialized ROS messages, and the remaining ones are in an
+ *   unknown yet valid state.
+ *
+ * \pre Given `serialized_message_sequence` must be a valid sequence, such as that filled
+ *   by rmw_serialize_sequence() or rmw_take_serialized_sequence(), matching the provided
+ *   typesupport.
+ * \pre Given typesupport must be a valid non-null instance, as provided
+ *   by `rosidl` APIs.
+ * \pre Given `ros_messages` must be a valid message sequence, initialized by
+ *   rmw_message_sequence_init(), whose first `serialized_message_sequence->size` entries
+ *   are valid ROS messages, initialized by the caller.
+ *
+ * \param[in] serialized_message_sequence the byte streams to deserialize
+ * \param[in] type_support the typesupport for all ROS messages
+ * \param[out] ros_messages destination for the deserialized ROS messages. Its size is set
+ *   to the number of ROS messages deserialized.
+ * \param[out] deserialized_count number of ROS messages actually deserialized
+ * \return `RMW_RET_OK` if all ROS messages were deserialized, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, in which case nothing
+ *   is deserialized, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `ros_messages` capacity is less than the
+ *   `serialized_message_sequence` size, in which case nothing is deserialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation failed, see partial failure above, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs, see partial failure above.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_deserialize_sequence(
+  const rmw_serialized_message_sequence_t * serialized_message_sequence,
+  const rosidl_message_type_support_t * type_support,
+  rmw_message_sequence_t * ros_messages,
+  size_t * deserialized_count);
+
 /// Initialize a subscription allocation to be used with later `take`s.
 /**
  * This creates an allocation object that can be used in conjunction with
@@ -1647,6 +2064,171 @@ rmw_take_serialized_message_with_info(
   rmw_message_info_t * message_info,
   rmw_subscription_allocation_t * allocation);
 
+/// Take multiple incoming ROS messages as byte streams with their metadata.
+/**
+ * Same as rmw_take_serialized_message_with_info(), for up to `count` ROS messages at once,
+ * which are appended to the given sequence in order.
+ * All byte streams share the sequence buffer, so draining a subscription allocates at most
+ * once, to grow that buffer, and not at all if it was reserved large enough beforehand.
+ * Callers should check the `RMW_FEATURE_SERIALIZED_SEQUENCE` feature, and fall back to
+ * rmw_take_serialized_message_with_info() if it is not supported.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ *
+ * <i>[1] implementation defined, check implementation documentation.</i>
+ *
+ * \par Runtime behavior
+ *   Same as rmw_take_sequence().
+ *
+ * \par Memory allocation
+ *   The sequence buffer is grown as needed using the sequence allocator, see
+ *   rmw_serialized_message_sequence_reserve().
+ *   Any other memory allocation is implementation defined.
+ *
+ * \par Thread-safety
+ *   Subscriptions are thread-safe objects, and so are all operations on them except for
+ *   finalization.
+ *   Therefore, it is safe to take from the same subscription concurrently.
+ *   Moreover, the sequence of ROS messages taken is guaranteed to be consecutive and to
+ *   preserve the order in the subscription queues, despite any concurrent takes.
+ *   However, when taking a sequence of serialized ROS messages with metadata:
+ *   - Access to the given sequence is not synchronized.
+ *     It is not safe to read or write `serialized_message_sequence` while
+ *     rmw_take_serialized_sequence() uses it.
+ *   - Access to the given ROS message metadata sequence is not synchronized.
+ *     It is not safe to read or write `message_info_sequence` while
+ *     rmw_take_serialized_sequence() uses it.
+ *   - Access to given primitive data-type arguments is not synchronized.
+ *     It is not safe to read or write `taken` while rmw_take_serialized_sequence() uses it.
+ *   - Access to the given subscription allocation is not synchronized,
+ *     unless specifically stated otherwise by the implementation.
+ *     Thus, it is generally not safe to read or write `allocation` while
+ *     rmw_take_serialized_sequence() uses it.
+ *
+ * \pre Given `subscription` must be a valid subscription, as returned
+ *   by rmw_create_subscription().
+ * \pre Given `serialized_message_sequence` must be a valid sequence, initialized by
+ *   rmw_serialized_message_sequence_init().
+ * \pre Given `message_info_sequence` must be a valid message metadata sequence,
+ *   initialized by rmw_message_info_sequence_init().
+ * \pre If not NULL, given `allocation` must be a valid subscription allocation initialized
+ *   with rmw_subscription_allocation_init() with a message type support that matches the
+ *   one registered with `subscription` on creation.
+ * \post Given `serialized_message_sequence` will remain a valid sequence, and
+ *   `message_info_sequence`, a valid message metadata sequence.
+ *   Both will be left unchanged if this function fails early due to a logical error, such as
+ *   an invalid argument, or in an unknown yet valid state if it fails due to a runtime error.
+ *   Both will also be left unchanged if this function succeeds but `taken` is zero.
+ *
+ * \param[in] subscription Subscription to take ROS messages from.
+ * \param[in] count Number of messages to attempt to take.
+ * \param[inout] serialized_message_sequence Sequence to append the byte streams to.
+ *   It is not reset first, so callers draining in a loop may keep appending to it.
+ * \param[out] message_info_sequence Sequence of additional message metadata, whose i-th
+ *   entry describes the i-th message taken by this call.
+ *   Message info sequence capacity has to be enough to hold all requested messages
+ *   metadata i.e. capacity has to be equal or greater than `count`.
+ * \param[out] taken Number of messages actually taken from subscription.
+ * \param[in] allocation Pre-allocated memory to use. May be NULL.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `subscription` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `serialized_message_sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message_info_sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `taken` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `count` is 0, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message_info_sequence` capacity is less than `count`, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `subscription` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if the implementation does not support taking sequences, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_take_serialized_sequence(
+  const rmw_subscription_t * subscription,
+  size_t count,
+  rmw_serialized_message_sequence_t * serialized_message_sequence,
+  rmw_message_info_sequence_t * message_info_sequence,
+  size_t * taken,
+  rmw_subscription_allocation_t * allocation);
+
+/// Take an incoming ROS message as a byte stream scattered into segments, with its metadata.
+/**
+ * Same as rmw_take_serialized_message_with_info(), except that the byte stream is written
+ * across the segments of `serialized_message`, in order, each filled up to its `length`.
+ * This lets callers receive e.g. a fixed-size header and a large payload straight into
+ * separate buffers.
+ * Callers should check the `RMW_FEATURE_SERIALIZED_MESSAGE_IOV` feature, and otherwise use
+ * rmw_take_serialized_message_with_info() and rmw_serialized_message_iov_scatter().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ *
+ * <i>[1] implementation defined, check implementation documentation.</i>
+ *
+ * \par Runtime behavior
+ *   Same as rmw_take_serialized_message_with_info().
+ *
+ * \par Memory allocation
+ *   Segments are never resized: if the incoming byte stream does not fit, the ROS message
+ *   is not taken and `RMW_RET_ERROR` is returned.
+ *   Any other memory allocation is implementation defined.
+ *
+ * \par Thread-safety
+ *   Same as rmw_take_serialized_message_with_info(): access to the segments, the bytes they
+ *   point to, `length`, `taken` and `message_info` is not synchronized.
+ *
+ * \pre Given `serialized_message` must be a valid segmented serialized message, initialized
+ *   by rmw_serialized_message_iov_init(), whose segments point to writable memory.
+ * \pre If not NULL, given `allocation` must be a valid subscription allocation initialized
+ *   with rmw_subscription_allocation_init() with a message type support that matches the
+ *   one registered with `subscription` on creation.
+ * \post The segments are left unchanged if this function fails early due to a logical error,
+ *   such as an invalid argument, or if it succeeds but `taken` is false.
+ *
+ * \param[in] subscription Subscription to take ROS message from.
+ * \param[inout] serialized_message Segments to write the byte stream to.
+ * \param[out] length Number of bytes written across the segments.
+ * \param[out] taken Boolean flag indicating if a ROS message was taken or not.
+ * \param[out] message_info Taken ROS message metadata.
+ * \param[in] allocation Pre-allocated memory to use. May be NULL.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `subscription` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `serialized_message` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `length` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `taken` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message_info` is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `subscription` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_UNSUPPORTED` if the implementation does not support segmented
+ *   serialized messages, or
+ * \return `RMW_RET_ERROR` if the byte stream does not fit in the segments, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_take_serialized_message_iov_with_info(
+  const rmw_subscription_t * subscription,
+  rmw_serialized_message_iov_t * serialized_message,
+  size_t * length,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  rmw_subscription_allocation_t * allocation);
+
 /// Take an incoming ROS message, loaned by the middleware.
 /**
  * Take a ROS message already received by the given subscription, removing it from internal queues.
@@ -0,0 +1,180 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__SERIALIZED_MESSAGE_IOV_H_
+#define RMW__SERIALIZED_MESSAGE_IOV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/serialized_message.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// A contiguous run of bytes, part of a serialized message.
+/**
+ * Same layout intent as POSIX `struct iovec`, so implementations may map segments
+ * one to one onto scatter-gather transport calls.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_segment_s
+{
+  /// First byte of the segment, not owned by the segment.
+  uint8_t * data;
+  /// Number of bytes in the segment.
+  size_t length;
+} rmw_serialized_message_segment_t;
+
+/// Serialized message as an ordered list of segments.
+/**
+ * The serialized message is the concatenation of all segments, e.g. a header followed
+ * by a large payload, without them having to be copied into a single buffer.
+ *
+ * The segment array is owned by this struct, but the bytes segments point to are not.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_iov_s
+{
+  /// Array of segments, in order.
+  rmw_serialized_message_segment_t * segments;
+  /// The number of valid segments.
+  size_t segment_count;
+  /// The total allocated capacity of the segment array.
+  size_t segment_capacity;
+  /// The allocator used to allocate the segment array.
+  rcutils_allocator_t * allocator;
+} rmw_serialized_message_iov_t;
+
+/// Return an rmw_serialized_message_iov_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_serialized_message_iov_t
+rmw_get_zero_initialized_serialized_message_iov(void);
+
+/// Initialize an rmw_serialized_message_iov_t object.
+/**
+ * \param[inout] iov serialized message to be initialized.
+ * \param[in] segment_capacity number of segments to make room for.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `iov` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_iov_init(
+  rmw_serialized_message_iov_t * iov,
+  size_t segment_capacity,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_serialized_message_iov_t object.
+/**
+ * Note: This will not deallocate the bytes the segments point to.
+ *
+ * \param[inout] iov serialized message to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `iov` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the allocator is invalid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_iov_fini(rmw_serialized_message_iov_t * iov);
+
+/// Append a segment, growing the segment array if needed.
+/**
+ * \param[inout] iov serialized message to append to.
+ * \param[in] data first byte of the segment. May be NULL if `length` is zero.
+ * \param[in] length number of bytes in the segment.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `iov` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `data` is NULL and `length` is not zero, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the allocator is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, leaving `iov` unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_iov_append(
+  rmw_serialized_message_iov_t * iov,
+  uint8_t * data,
+  size_t length);
+
+/// Get the total number of bytes over all segments.
+/**
+ * \param[in] iov serialized message to inspect.
+ * \param[out] length the total number of bytes.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `iov` or `length` is NULL, or
+ * \return `RMW_RET_ERROR` if the total number of bytes overflows.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_iov_get_length(
+  const rmw_serialized_message_iov_t * iov,
+  size_t * length);
+
+/// Concatenate all segments into a contiguous serialized message.
+/**
+ * This is the fallback for implementations without scatter-gather support.
+ *
+ * \param[in] iov serialized message to copy from.
+ * \param[inout] serialized_message serialized message to copy into, initialized with
+ *   rmw_serialized_message_init() and resized if it is too small.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `iov` or `serialized_message` is NULL, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_iov_gather(
+  const rmw_serialized_message_iov_t * iov,
+  rmw_serialized_message_t * serialized_message);
+
+/// Copy contiguous bytes across the segments, in order.
+/**
+ * Segments are filled up to their `length`, which is thus their capacity.
+ *
+ * \param[in] data bytes to copy from. May be NULL if `length` is zero.
+ * \param[in] length number of bytes to copy.
+ * \param[inout] iov serialized message whose segments are copied into.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `iov` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `data` is NULL and `length` is not zero, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the segments cannot hold `length` bytes,
+ *   in which case nothing is copied.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_iov_scatter(
+  const uint8_t * data,
+  size_t length,
+  rmw_serialized_message_iov_t * iov);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__SERIALIZED_MESSAGE_IOV_H_
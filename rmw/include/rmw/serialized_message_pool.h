@@ -0,0 +1,171 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__SERIALIZED_MESSAGE_POOL_H_
+#define RMW__SERIALIZED_MESSAGE_POOL_H_
+
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Maximum number of size classes of a serialized message pool.
+#define RMW_SERIALIZED_MESSAGE_POOL_MAX_SIZE_CLASSES 32u
+
+/// Options of a serialized message pool.
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_pool_options_s
+{
+  /// Size of the smallest size class, in bytes, a power of two.
+  size_t min_block_size;
+  /// Size of the largest size class, in bytes, a power of two.
+  /**
+   * Larger buffers bypass the pool and go straight to the backing allocator.
+   * There can be at most `RMW_SERIALIZED_MESSAGE_POOL_MAX_SIZE_CLASSES` size classes
+   * from `min_block_size` to `max_block_size`.
+   */
+  size_t max_block_size;
+  /// Number of free blocks each thread keeps per size class, zero to disable thread caches.
+  size_t thread_cache_capacity;
+  /// Number of free blocks the shared depot keeps per size class.
+  /**
+   * Blocks freed beyond that are given back to the backing allocator.
+   */
+  size_t depot_capacity;
+} rmw_serialized_message_pool_options_t;
+
+/// Implementation of a serialized message pool, opaque to users.
+typedef struct rmw_serialized_message_pool_impl_s rmw_serialized_message_pool_impl_t;
+
+/// Pool of serialized message buffers, sorted by power-of-two size classes.
+/**
+ * The pool hands out an `rcutils_allocator_t` that serialized messages are initialized
+ * with, see rmw_serialized_message_pool_get_allocator().
+ * Requests are rounded up to their size class, so resizing within a size class does not
+ * allocate, and freed buffers are kept for reuse:
+ * - first in a cache local to the freeing thread, which needs no synchronization,
+ * - then, once that cache is full, in a depot shared by all threads, guarded by a spin lock,
+ * - then, once that depot is full, back to the backing allocator.
+ *
+ * Acquiring and releasing a buffer is thus O(1), and does not reach the backing allocator
+ * once the pool is warm.
+ * Thread caches work best when each thread sticks to a few pools.
+ * When a thread exits, the buffers in its caches go to the depot, or back to the backing
+ * allocator once the depot is full, and its caches are reused by threads created later.
+ * The number of caches of a pool is thus bounded by the number of threads using it at once.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_pool_s
+{
+  /// Implementation of the pool.
+  rmw_serialized_message_pool_impl_t * impl;
+} rmw_serialized_message_pool_t;
+
+/// Return an rmw_serialized_message_pool_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_serialized_message_pool_t
+rmw_get_zero_initialized_serialized_message_pool(void);
+
+/// Return default serialized message pool options.
+/**
+ * Size classes go from 64 bytes to 1 MiB, each thread keeps up to 8 free blocks per
+ * size class and the depot up to 64.
+ */
+RMW_PUBLIC
+rmw_serialized_message_pool_options_t
+rmw_get_default_serialized_message_pool_options(void);
+
+/// Initialize a serialized message pool.
+/**
+ * No buffer is allocated up front, the pool fills up as buffers are released to it.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \param[inout] pool zero initialized pool to be initialized.
+ * \param[in] options pool options.
+ * \param[in] allocator backing allocator, used for buffers and bookkeeping alike.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` or `options` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if block sizes are not powers of two, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `min_block_size` is smaller than a pointer, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `max_block_size` is smaller than `min_block_size`, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if there would be too many size classes, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_init(
+  rmw_serialized_message_pool_t * pool,
+  const rmw_serialized_message_pool_options_t * options,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a serialized message pool.
+/**
+ * All free buffers are given back to the backing allocator, including those sitting in
+ * the caches of other threads.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \pre No buffer allocated from the pool may be in use, and the pool allocator may not
+ *   be used concurrently nor afterwards.
+ *
+ * \param[inout] pool pool to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_fini(rmw_serialized_message_pool_t * pool);
+
+/// Get an allocator that allocates from the pool.
+/**
+ * The allocator can be passed to rmw_serialized_message_init(), or anywhere else an
+ * `rcutils_allocator_t` is expected.
+ * It is thread-safe, and only valid as long as the pool is.
+ *
+ * \param[in] pool pool to allocate from.
+ * \return an allocator backed by the pool, or
+ * \return a zero initialized, thus invalid, allocator if `pool` is NULL or not initialized.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rcutils_allocator_t
+rmw_serialized_message_pool_get_allocator(const rmw_serialized_message_pool_t * pool);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__SERIALIZED_MESSAGE_POOL_H_
@@ -0,0 +1,172 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__SERIALIZED_MESSAGE_SEQUENCE_H_
+#define RMW__SERIALIZED_MESSAGE_SEQUENCE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Structure to hold a sequence of serialized ROS messages sharing a single buffer.
+/**
+ * Serialized messages are stored back to back in `buffer`.
+ * The i-th one spans bytes `[offsets[i], offsets[i + 1])`, so `offsets` has room
+ * for `capacity + 1` entries and `offsets[size]` is the number of bytes in use.
+ *
+ * The offset table and the buffer live in a single allocation, owned by the sequence.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_sequence_s
+{
+  /// Offset table, with `capacity + 1` entries, starting with 0.
+  size_t * offsets;
+  /// Buffer holding all serialized messages.
+  uint8_t * buffer;
+  /// The total allocated capacity of the buffer, in bytes.
+  size_t buffer_capacity;
+  /// The number of valid serialized messages.
+  size_t size;
+  /// The total allocated capacity of the offset table, in serialized messages.
+  size_t capacity;
+  /// The allocator used to allocate the offset table and the buffer.
+  rcutils_allocator_t * allocator;
+} rmw_serialized_message_sequence_t;
+
+/// Return an rmw_serialized_message_sequence_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_serialized_message_sequence_t
+rmw_get_zero_initialized_serialized_message_sequence(void);
+
+/// Initialize an rmw_serialized_message_sequence_t object.
+/**
+ * \param[inout] sequence sequence object to be initialized.
+ * \param[in] capacity number of serialized messages to make room for.
+ * \param[in] buffer_capacity number of bytes to make room for, over all serialized messages.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_sequence_init(
+  rmw_serialized_message_sequence_t * sequence,
+  size_t capacity,
+  size_t buffer_capacity,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_serialized_message_sequence_t object.
+/**
+ * \param[inout] sequence sequence object to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the sequence allocator is invalid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_sequence_fini(rmw_serialized_message_sequence_t * sequence);
+
+/// Drop all serialized messages, keeping the allocated capacities.
+/**
+ * \param[inout] sequence sequence to be emptied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_sequence_reset(rmw_serialized_message_sequence_t * sequence);
+
+/// Make room for at least `capacity` serialized messages and `buffer_capacity` bytes.
+/**
+ * Contents are preserved, but may be moved, which invalidates pointers into the buffer.
+ *
+ * \param[inout] sequence sequence to be grown.
+ * \param[in] capacity number of serialized messages to make room for.
+ * \param[in] buffer_capacity number of bytes to make room for, over all serialized messages.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the sequence allocator is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, leaving `sequence` unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_sequence_reserve(
+  rmw_serialized_message_sequence_t * sequence,
+  size_t capacity,
+  size_t buffer_capacity);
+
+/// Copy a serialized message at the end of the sequence.
+/**
+ * The sequence is grown as needed, at least doubling whichever capacity runs out,
+ * so appends are amortized O(length).
+ *
+ * \param[inout] sequence sequence to append to.
+ * \param[in] data serialized message bytes. May be NULL if `length` is zero.
+ * \param[in] length number of bytes in `data`.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `data` is NULL and `length` is not zero, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the sequence allocator is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, leaving `sequence` unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_sequence_append(
+  rmw_serialized_message_sequence_t * sequence,
+  const uint8_t * data,
+  size_t length);
+
+/// Get a serialized message of the sequence.
+/**
+ * The returned pointer is into the sequence buffer, and is invalidated by any
+ * function that grows or finalizes the sequence.
+ *
+ * \param[in] sequence sequence to read from.
+ * \param[in] index index of the serialized message.
+ * \param[out] data first byte of the serialized message.
+ * \param[out] length number of bytes of the serialized message.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence`, `data` or `length` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `index` is out of range.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_sequence_get(
+  const rmw_serialized_message_sequence_t * sequence,
+  size_t index,
+  const uint8_t ** data,
+  size_t * length);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__SERIALIZED_MESSAGE_SEQUENCE_H_
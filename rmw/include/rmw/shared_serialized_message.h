@@ -0,0 +1,234 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__SHARED_SERIALIZED_MESSAGE_H_
+#define RMW__SHARED_SERIALIZED_MESSAGE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/serialized_message.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Function releasing the buffer of a shared serialized message, once it is no longer used.
+/**
+ * \param[in] buffer the buffer to release.
+ * \param[in] buffer_length number of bytes in the buffer.
+ * \param[in] state the state given along with the deleter.
+ */
+typedef void (* rmw_shared_serialized_message_deleter_t)(
+  uint8_t * buffer,
+  size_t buffer_length,
+  void * state);
+
+/// Control block shared by all references to a serialized message, opaque to users.
+typedef struct rmw_shared_serialized_message_impl_s rmw_shared_serialized_message_impl_t;
+
+/// Reference to an immutable serialized message shared by multiple holders.
+/**
+ * Each holder owns one reference, taken with rmw_shared_serialized_message_acquire()
+ * and given back with rmw_shared_serialized_message_fini().
+ * The buffer is released by the last one to do so, whatever the thread.
+ *
+ * The buffer must not be modified once shared, so that holders can read it without
+ * synchronization.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_shared_serialized_message_s
+{
+  /// The serialized message bytes.
+  const uint8_t * buffer;
+  /// Number of bytes in the buffer.
+  size_t buffer_length;
+  /// Reference counted control block.
+  rmw_shared_serialized_message_impl_t * impl;
+} rmw_shared_serialized_message_t;
+
+/// Return an rmw_shared_serialized_message_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_shared_serialized_message_t
+rmw_get_zero_initialized_shared_serialized_message(void);
+
+/// Share a serialized message, taking ownership of its buffer.
+/**
+ * No bytes are copied: the buffer moves to `shared`, and `serialized_message` is left
+ * zero initialized.
+ * The buffer is eventually deallocated with the allocator of `serialized_message`.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] shared zero initialized shared serialized message to initialize, holding
+ *   the first reference.
+ * \param[inout] serialized_message serialized message to take the buffer from, initialized
+ *   with rmw_serialized_message_init().
+ * \param[in] allocator the allocator used to allocate the control block.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared` or `serialized_message` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` or the serialized message
+ *   allocator is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, leaving `serialized_message`
+ *   unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_init_from(
+  rmw_shared_serialized_message_t * shared,
+  rmw_serialized_message_t * serialized_message,
+  rcutils_allocator_t * allocator);
+
+/// Share a buffer, released with a custom deleter.
+/**
+ * This lets memory that does not come from an rcutils allocator be shared, e.g. a
+ * middleware owned or memory mapped buffer.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] shared zero initialized shared serialized message to initialize, holding
+ *   the first reference.
+ * \param[in] buffer the serialized message bytes. May be NULL if `buffer_length` is zero.
+ * \param[in] buffer_length number of bytes in the buffer.
+ * \param[in] deleter function to call on the buffer once no longer referenced.
+ * \param[in] deleter_state state to pass to `deleter`. May be NULL.
+ * \param[in] allocator the allocator used to allocate the control block.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared` or `deleter` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `buffer` is NULL and `buffer_length` is not zero, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case `deleter` is
+ *   not called.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_init_with_deleter(
+  rmw_shared_serialized_message_t * shared,
+  uint8_t * buffer,
+  size_t buffer_length,
+  rmw_shared_serialized_message_deleter_t deleter,
+  void * deleter_state,
+  rcutils_allocator_t * allocator);
+
+/// Take another reference to a shared serialized message.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes [1]
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [2]
+ * <i>[1] as long as `source` holds its reference for the duration of the call</i>
+ * <i>[2] if `atomic_is_lock_free()` returns true for `atomic_uint_least64_t`</i>
+ *
+ * \param[in] source reference to share.
+ * \param[out] destination zero initialized shared serialized message to hold the new reference.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `source` or `destination` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `source` holds no reference.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_acquire(
+  const rmw_shared_serialized_message_t * source,
+  rmw_shared_serialized_message_t * destination);
+
+/// Give back a reference to a shared serialized message.
+/**
+ * The last reference to be given back releases the buffer and the control block.
+ * `shared` is left zero initialized.
+ * Giving back a zero initialized shared serialized message does nothing.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes [1]
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [2]
+ * <i>[1] for distinct references, even to the same serialized message</i>
+ * <i>[2] if `atomic_is_lock_free()` returns true for `atomic_uint_least64_t`, and
+ *   as long as the deleter and the allocator are</i>
+ *
+ * \param[inout] shared reference to give back.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_fini(rmw_shared_serialized_message_t * shared);
+
+/// Get the number of references to a shared serialized message.
+/**
+ * The result may be outdated as soon as it is returned if other threads hold references.
+ *
+ * \param[in] shared reference to inspect.
+ * \param[out] use_count the number of references, zero if `shared` holds none.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared` or `use_count` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_get_use_count(
+  const rmw_shared_serialized_message_t * shared,
+  size_t * use_count);
+
+/// Get a serialized message view of a shared serialized message, without copying.
+/**
+ * The view can be passed to functions taking a const serialized message, like
+ * rmw_publish_serialized_message().
+ * It borrows the buffer of `shared`, must not be modified nor finalized, and is only
+ * valid as long as `shared` holds its reference.
+ *
+ * \param[in] shared reference to view.
+ * \param[out] view serialized message pointing to the shared buffer, with an
+ *   invalid allocator.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared` or `view` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_get_view(
+  const rmw_shared_serialized_message_t * shared,
+  rmw_serialized_message_t * view);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__SHARED_SERIALIZED_MESSAGE_H_
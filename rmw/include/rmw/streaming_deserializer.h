@@ -0,0 +1,190 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__STREAMING_DESERIALIZER_H_
+#define RMW__STREAMING_DESERIALIZER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Resumable deserialization of a ROS message from byte stream chunks.
+/**
+ * Unlike rmw_deserialize(), which needs the whole byte stream at once, a streaming
+ * deserializer is fed the byte stream chunk by chunk, e.g. as it is received over a slow
+ * link or read from disk, and decodes each chunk as it comes.
+ * Decoding thus overlaps with I/O, and the byte stream never needs to be held in full.
+ *
+ * Streaming deserializers are provided by the rmw implementation.
+ * Callers should check the `RMW_FEATURE_STREAMING_DESERIALIZATION` feature, and otherwise
+ * gather the byte stream and use rmw_deserialize().
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_streaming_deserializer_s
+{
+  /// Implementation identifier, used to ensure two different implementations are not being mixed.
+  const char * implementation_identifier;
+  /// Decoding state, specific to the implementation.
+  void * data;
+} rmw_streaming_deserializer_t;
+
+/// Return a zero initialized streaming deserializer structure.
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_streaming_deserializer_t
+rmw_get_zero_initialized_streaming_deserializer(void);
+
+/// Initialize a streaming deserializer.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Maybe [1]
+ * Lock-Free          | Maybe [1]
+ * <i>[1] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \pre Given typesupport must be a valid non-null instance, as provided
+ *   by `rosidl` APIs.
+ * \pre Given ROS message must be a valid non-null instance, initialized
+ *   by the caller and matching the provided typesupport.
+ *   It must outlive the decoding, and must not be accessed until decoding completes,
+ *   see rmw_streaming_deserializer_feed().
+ *
+ * \param[inout] deserializer zero initialized streaming deserializer to be initialized.
+ * \param[in] type_support the typesupport for the typed ROS message
+ * \param[out] ros_message destination for the deserialized ROS message
+ * \param[in] allocator the allocator used for the decoding state.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RMW_RET_UNSUPPORTED` if it's unimplemented, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_streaming_deserializer_init(
+  rmw_streaming_deserializer_t * deserializer,
+  const rosidl_message_type_support_t * type_support,
+  void * ros_message,
+  const rcutils_allocator_t * allocator);
+
+/// Feed the next chunk of the byte stream to a streaming deserializer.
+/**
+ * The chunk is decoded into the ROS message as far as possible.
+ * Values split across chunks are kept by the deserializer until the rest comes in, so the
+ * chunk need not outlive the call.
+ * Chunks may be of any size, down to a single byte, in which case memory is allocated to
+ * keep split values.
+ *
+ * Decoding completes once the whole byte stream has been fed, after which the ROS message
+ * holds the same contents rmw_deserialize() would have produced.
+ * Bytes past the end of the byte stream, e.g. those of the next serialized message in a
+ * file, are not consumed.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Maybe [2]
+ * Lock-Free          | Maybe [2]
+ * <i>[1] if the ROS message contains unbounded fields, or values are split across chunks</i>
+ * <i>[2] rmw implementation defined, check the implementation documentation</i>
+ *
+ * \param[inout] deserializer streaming deserializer to feed.
+ * \param[in] chunk the next bytes of the byte stream. May be NULL if `chunk_length` is zero.
+ * \param[in] chunk_length number of bytes in `chunk`.
+ * \param[out] consumed number of bytes of `chunk` consumed, which is `chunk_length` unless
+ *   decoding completed within the chunk.
+ * \param[out] complete whether decoding completed, with this or an earlier chunk.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `deserializer`, `consumed` or `complete` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `chunk` is NULL and `chunk_length` is not zero, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `deserializer` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RMW_RET_ERROR` if the byte stream is malformed, after which decoding cannot
+ *   resume until rmw_streaming_deserializer_reset() is called.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_streaming_deserializer_feed(
+  rmw_streaming_deserializer_t * deserializer,
+  const uint8_t * chunk,
+  size_t chunk_length,
+  size_t * consumed,
+  bool * complete);
+
+/// Restart a streaming deserializer on a new ROS message of the same type.
+/**
+ * This lets a streaming deserializer decode one ROS message after another, reusing its
+ * decoding state rather than being finalized and initialized again.
+ * Any decoding in progress is abandoned, leaving its ROS message in an unknown yet
+ * valid state.
+ *
+ * \param[inout] deserializer streaming deserializer to restart.
+ * \param[out] ros_message destination for the next deserialized ROS message, with the same
+ *   requirements as the one given to rmw_streaming_deserializer_init().
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `deserializer` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_streaming_deserializer_reset(
+  rmw_streaming_deserializer_t * deserializer,
+  void * ros_message);
+
+/// Finalize a streaming deserializer.
+/**
+ * Any decoding in progress is abandoned, leaving its ROS message in an unknown yet
+ * valid state.
+ *
+ * \param[inout] deserializer streaming deserializer to be finalized, left zero initialized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `deserializer` is NULL, or
+ * \return `RMW_RET_INCORRECT_RMW_IMPLEMENTATION` if the `deserializer` implementation
+ *   identifier does not match this implementation, or
+ * \return `RMW_RET_ERROR` if an unexpected error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_streaming_deserializer_fini(rmw_streaming_deserializer_t * deserializer);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__STREAMING_DESERIALIZER_H_
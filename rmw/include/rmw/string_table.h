@@ -0,0 +1,175 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__STRING_TABLE_H_
+#define RMW__STRING_TABLE_H_
+
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Implementation of a string table, opaque to users.
+typedef struct rmw_string_table_impl_s rmw_string_table_impl_t;
+
+/// Table of interned strings, e.g. the topic names, node names and type names of a graph.
+/**
+ * Interning a string gives a pointer to the single copy of it the table holds, so that a
+ * name shared by many graph entities is stored once, handing it out is a pointer copy, and
+ * two strings interned in the same table are equal if and only if their pointers are.
+ *
+ * Interned strings are immutable, and stay at the same address until the table is
+ * finalized, so rmw implementations usually keep one table per context, finalized along
+ * with it, and intern the names their graph queries return.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_string_table_s
+{
+  /// Implementation of the table.
+  rmw_string_table_impl_t * impl;
+} rmw_string_table_t;
+
+/// Return an rmw_string_table_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_string_table_t
+rmw_get_zero_initialized_string_table(void);
+
+/// Initialize a string table.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] table zero initialized table to be initialized.
+ * \param[in] allocator allocator used for the table and its strings.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is already initialized, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_string_table_init(rmw_string_table_t * table, const rcutils_allocator_t * allocator);
+
+/// Finalize a string table, deallocating all strings interned in it.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \pre No string interned in the table may be in use.
+ *
+ * \param[inout] table table to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_string_table_fini(rmw_string_table_t * table);
+
+/// Intern a string in a table.
+/**
+ * The string is copied into the table the first time it is interned, and looked up
+ * afterwards.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \par Thread-safety
+ *   Interning is guarded by a spin lock, only held to look up and insert strings, not to
+ *   allocate them.
+ *
+ * \param[in] table table to intern the string in.
+ * \param[in] string null terminated string to be interned.
+ * \param[out] interned interned copy of `string`, valid as long as the table is.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table`, `string` or `interned` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_string_table_intern(
+  rmw_string_table_t * table,
+  const char * string,
+  const char ** interned);
+
+/// Intern the first characters of a string in a table.
+/**
+ * This is an overload with an extra parameter for the length of string, which need not be
+ * null terminated, e.g. when it is part of a larger buffer.
+ * The interned copy is null terminated.
+ *
+ * \sa rmw_string_table_intern(rmw_string_table_t *, const char *, const char **)
+ *
+ * \param[in] table table to intern the string in.
+ * \param[in] string string to be interned.
+ * \param[in] length number of characters of `string` to be interned.
+ * \param[out] interned interned copy of `string`, valid as long as the table is.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table`, `string` or `interned` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_string_table_intern_with_size(
+  rmw_string_table_t * table,
+  const char * string,
+  size_t length,
+  const char ** interned);
+
+/// Get the number of distinct strings interned in a table.
+/**
+ * \param[in] table table to be queried.
+ * \param[out] size number of strings in the table.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` or `size` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is not initialized.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_string_table_get_size(const rmw_string_table_t * table, size_t * size);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__STRING_TABLE_H_
@@ -22,9 +22,17 @@ extern "C"
 
 #include "rcutils/allocator.h"
 #include "rosidl_runtime_c/type_hash.h"
+#include "rmw/string_table.h"
 #include "rmw/types.h"
 #include "rmw/visibility_control.h"
 
+/// `node_name` is interned, see rmw_topic_endpoint_info_t::interned_strings.
+#define RMW_TOPIC_ENDPOINT_INFO_NODE_NAME_INTERNED 0x1u
+/// `node_namespace` is interned, see rmw_topic_endpoint_info_t::interned_strings.
+#define RMW_TOPIC_ENDPOINT_INFO_NODE_NAMESPACE_INTERNED 0x2u
+/// `topic_type` is interned, see rmw_topic_endpoint_info_t::interned_strings.
+#define RMW_TOPIC_ENDPOINT_INFO_TOPIC_TYPE_INTERNED 0x4u
+
 /// A data structure that encapsulates the node name, node namespace,
 /// topic_type, gid, and qos_profile of publishers and subscriptions
 /// for a topic.
@@ -44,6 +52,13 @@ typedef struct RMW_PUBLIC_TYPE rmw_topic_endpoint_info_s
   uint8_t endpoint_gid[RMW_GID_STORAGE_SIZE];
   /// QoS profile of the endpoint
   rmw_qos_profile_t qos_profile;
+  /// Which strings are interned in an rmw_string_table_t, rather than owned by this struct
+  /**
+   * A bitwise or of `RMW_TOPIC_ENDPOINT_INFO_*_INTERNED` flags, kept up to date by the
+   * `rmw_topic_endpoint_info_set_*()` functions.
+   * Interned strings are left alone by rmw_topic_endpoint_info_fini().
+   */
+  uint8_t interned_strings;
 } rmw_topic_endpoint_info_t;
 
 /// Return zero initialized topic endpoint info data structure.
@@ -60,6 +75,7 @@ rmw_get_zero_initialized_topic_endpoint_info(void);
 /**
  * Deallocates all allocated members of the given data structure,
  * and then zero initializes it.
+ * Interned strings are not deallocated, as they belong to their string table.
  * If a logical error, such as `RMW_RET_INVALID_ARGUMENT`, ensues, this function
  * will return early, leaving the given data structure unchanged.
  * Otherwise, it will proceed despite errors.
@@ -138,6 +154,51 @@ rmw_topic_endpoint_info_set_topic_type(
   const char * topic_type,
   rcutils_allocator_t * allocator);
 
+/// Set the topic type in the given topic endpoint info data structure to an interned string.
+/**
+ * Interns the value of the `topic_type` argument in `string_table`, and sets the data
+ * structure's `topic_type` member to the interned string, rather than to a copy of its own.
+ * Endpoint infos with the same topic type thus share a single string, which
+ * rmw_topic_endpoint_info_fini() does not deallocate.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \par Thread-safety
+ *   Setting a member is a reentrant procedure, but:
+ *   - Access to the topic endpoint info data structure is not synchronized.
+ *     It is not safe to read or write the `topic_type` member of the given `topic_endpoint`
+ *     while setting it.
+ *   - Interning a string in the table is thread-safe.
+ *
+ * \pre Given `topic_type` is a valid C-style string i.e. NULL terminated.
+ * \pre The member was not set before, or its value was interned too.
+ * \pre `string_table` outlives the data structure.
+ *
+ * \param[inout] topic_endpoint_info Data structure to be populated.
+ * \param[in] topic_type Topic type to be set.
+ * \param[in] string_table Initialized string table to intern `topic_type` in.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_type` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `string_table` is NULL or not initialized, or
+ * \returns `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \returns `RMW_RET_ERROR` when an unspecified error occurs.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_set_topic_type_interned(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char * topic_type,
+  rmw_string_table_t * string_table);
+
 /// Set the topic type hash in the given topic endpoint info data structure.
 /**
  * Assigns the value of the `topic_type_hash` argument to the data structure's
@@ -216,6 +277,51 @@ rmw_topic_endpoint_info_set_node_name(
   const char * node_name,
   rcutils_allocator_t * allocator);
 
+/// Set the node name in the given topic endpoint info data structure to an interned string.
+/**
+ * Interns the value of the `node_name` argument in `string_table`, and sets the data
+ * structure's `node_name` member to the interned string, rather than to a copy of its own.
+ * Endpoint infos with the same node name thus share a single string, which
+ * rmw_topic_endpoint_info_fini() does not deallocate.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \par Thread-safety
+ *   Setting a member is a reentrant procedure, but:
+ *   - Access to the topic endpoint info data structure is not synchronized.
+ *     It is not safe to read or write the `node_name` member of the given `topic_endpoint`
+ *     while setting it.
+ *   - Interning a string in the table is thread-safe.
+ *
+ * \pre Given `node_name` is a valid C-style string i.e. NULL terminated.
+ * \pre The member was not set before, or its value was interned too.
+ * \pre `string_table` outlives the data structure.
+ *
+ * \param[inout] topic_endpoint_info Data structure to be populated.
+ * \param[in] node_name Node name to be set.
+ * \param[in] string_table Initialized string table to intern `node_name` in.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `node_name` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `string_table` is NULL or not initialized, or
+ * \returns `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \returns `RMW_RET_ERROR` when an unspecified error occurs.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_set_node_name_interned(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char * node_name,
+  rmw_string_table_t * string_table);
+
 /// Set the node namespace in the given topic endpoint info data structure.
 /**
  * Allocates memory and copies the value of the `node_namespace`
@@ -259,6 +365,51 @@ rmw_topic_endpoint_info_set_node_namespace(
   const char * node_namespace,
   rcutils_allocator_t * allocator);
 
+/// Set the node namespace in the given topic endpoint info data structure to an interned string.
+/**
+ * Interns the value of the `node_namespace` argument in `string_table`, and sets the data
+ * structure's `node_namespace` member to the interned string, rather than to a copy of its own.
+ * Endpoint infos with the same node namespace thus share a single string, which
+ * rmw_topic_endpoint_info_fini() does not deallocate.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \par Thread-safety
+ *   Setting a member is a reentrant procedure, but:
+ *   - Access to the topic endpoint info data structure is not synchronized.
+ *     It is not safe to read or write the `node_namespace` member of the given `topic_endpoint`
+ *     while setting it.
+ *   - Interning a string in the table is thread-safe.
+ *
+ * \pre Given `node_namespace` is a valid C-style string i.e. NULL terminated.
+ * \pre The member was not set before, or its value was interned too.
+ * \pre `string_table` outlives the data structure.
+ *
+ * \param[inout] topic_endpoint_info Data structure to be populated.
+ * \param[in] node_namespace Node namespace to be set.
+ * \param[in] string_table Initialized string table to intern `node_namespace` in.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `node_namespace` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `string_table` is NULL or not initialized, or
+ * \returns `RMW_RET_BAD_ALLOC` if memory allocation fails, or
+ * \returns `RMW_RET_ERROR` when an unspecified error occurs.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_set_node_namespace_interned(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char * node_namespace,
+  rmw_string_table_t * string_table);
+
 /// Set the endpoint type in the given topic endpoint info data structure.
 /**
  * Assigns the value of the `type` argument to the data structure's
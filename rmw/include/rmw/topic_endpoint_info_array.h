@@ -148,6 +148,41 @@ rmw_topic_endpoint_info_array_fini(
   rmw_topic_endpoint_info_array_t * topic_endpoint_info_array,
   rcutils_allocator_t * allocator);
 
+/// Sort an array of topic endpoint information by endpoint GID.
+/**
+ * Elements are sorted in ascending order of `endpoint_gid`, compared byte by byte.
+ * Two arrays sorted this way, e.g. two snapshots of the publishers of a topic,
+ * can be diffed in a single merge-like pass to find the endpoints only one of them has,
+ * rather than by comparing every pair of endpoints.
+ *
+ * Elements are moved, not copied, so an index built over the array with
+ * rmw_topic_endpoint_info_index_init() is invalidated.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Access to the array of topic endpoint information is not synchronized.
+ *   It is not safe to read or write `topic_endpoint_info_array` while it is sorted.
+ *
+ * \param[inout] topic_endpoint_info_array Array to be sorted.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info_array` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info_array` has elements
+ *   but no storage.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_array_sort_by_gid(
+  rmw_topic_endpoint_info_array_t * topic_endpoint_info_array);
+
 #ifdef __cplusplus
 }
 #endif
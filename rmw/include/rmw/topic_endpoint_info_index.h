@@ -0,0 +1,223 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__TOPIC_ENDPOINT_INFO_INDEX_H_
+#define RMW__TOPIC_ENDPOINT_INFO_INDEX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/topic_endpoint_info_array.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Hash index over an array of topic endpoint information.
+/**
+ * The index finds elements of the array by endpoint GID, and optionally by node name and
+ * namespace, in constant expected time instead of scanning the array.
+ * It refers to the array without copying it, so the array must outlive the index, and must
+ * not be modified, e.g. sorted with rmw_topic_endpoint_info_array_sort_by_gid(), while it
+ * is indexed.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_topic_endpoint_info_index_s
+{
+  /// Indexed array.
+  const rmw_topic_endpoint_info_array_t * topic_endpoint_info_array;
+  /// Number of slots of each hash table, a power of two.
+  size_t capacity;
+  /// Open addressing hash table by endpoint GID, holding array positions plus one,
+  /// or 0 in empty slots.
+  size_t * gid_slots;
+  /// Open addressing hash table by node name and namespace, holding the array position
+  /// plus one of the first element of each node, or 0 in empty slots, or NULL if nodes
+  /// are not indexed.
+  size_t * node_slots;
+  /// Array position plus one of the next element of the same node, for each element,
+  /// or 0 after the last one, or NULL if nodes are not indexed.
+  /// It is allocated along with `node_slots`.
+  size_t * node_next;
+  /// Allocator used for the hash tables.
+  rcutils_allocator_t allocator;
+} rmw_topic_endpoint_info_index_t;
+
+/// Return a zero initialized topic endpoint information index.
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_topic_endpoint_info_index_t
+rmw_get_zero_initialized_topic_endpoint_info_index(void);
+
+/// Build an index over an array of topic endpoint information.
+/**
+ * All elements are indexed by endpoint GID.
+ * If `index_nodes` is true, elements with a node name and namespace are also indexed by
+ * those.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Initialization is a reentrant procedure, but:
+ *   - Access to the index is not synchronized.
+ *     It is not safe to read or write `index` during initialization.
+ *   - Access to the array of topic endpoint information is read-only, but it is not
+ *     synchronized.
+ *     It is not safe to write `topic_endpoint_info_array` during initialization.
+ *   - The default allocators are thread-safe objects, but any custom `allocator` may not be.
+ *     Check your allocator documentation for further reference.
+ *
+ * \param[inout] index zero initialized index to be initialized on success,
+ *   but left unchanged on failure.
+ * \param[in] topic_endpoint_info_array Array to be indexed.
+ * \param[in] index_nodes Whether to index elements by node name and namespace too.
+ * \param[in] allocator Allocator to be used for the hash tables.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index` is not zero initialized, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info_array` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `topic_endpoint_info_array` has elements
+ *   but no storage, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid,
+ *   by rcutils_allocator_is_valid() definition, or
+ * \returns `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_index_init(
+  rmw_topic_endpoint_info_index_t * index,
+  const rmw_topic_endpoint_info_array_t * topic_endpoint_info_array,
+  bool index_nodes,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a topic endpoint information index.
+/**
+ * This function deallocates the hash tables, leaving the indexed array untouched,
+ * and then zero initializes the index.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] index index to be finalized.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index` is NULL.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_index_fini(rmw_topic_endpoint_info_index_t * index);
+
+/// Find the element of an indexed array with a given endpoint GID.
+/**
+ * If several elements have the same endpoint GID, any of them is found.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Access to the index and the indexed array is read-only, but it is not synchronized.
+ *   Concurrent lookups are safe, but concurrent lookups and writes are not.
+ *
+ * \param[in] index index to look the endpoint GID up in.
+ * \param[in] endpoint_gid endpoint GID to look up, of `RMW_GID_STORAGE_SIZE` bytes.
+ * \param[out] topic_endpoint_info element with the given endpoint GID, or NULL if none.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index` is not initialized.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_index_find_by_gid(
+  const rmw_topic_endpoint_info_index_t * index,
+  const uint8_t * endpoint_gid,
+  const rmw_topic_endpoint_info_t ** topic_endpoint_info);
+
+/// Find the elements of an indexed array with a given node name and namespace, one by one.
+/**
+ * Nodes usually have several endpoints, so this function finds the first element with the
+ * given node name and namespace when `previous` is NULL, and the next one otherwise.
+ * Elements are found in array order.
+ * Finding the first element takes constant expected time, and each next one constant time,
+ * so going through all `k` elements of a node takes `O(k)` time.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \par Thread-safety
+ *   Access to the index and the indexed array is read-only, but it is not synchronized.
+ *   Concurrent lookups are safe, but concurrent lookups and writes are not.
+ *
+ * \param[in] index index to look the node up in, with nodes indexed.
+ * \param[in] node_name name of the node to look up.
+ * \param[in] node_namespace namespace of the node to look up.
+ * \param[in] previous element found by the previous call with the same node name and
+ *   namespace, or NULL to find the first element.
+ * \param[out] topic_endpoint_info next element with the given node name and namespace,
+ *   or NULL if there are no more.
+ * \returns `RMW_RET_OK` if successful, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index`, `node_name`, `node_namespace` or
+ *   `topic_endpoint_info` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index` is not initialized, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `index` does not index nodes, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `previous` is not NULL nor an element of the
+ *   indexed array with the given node name and namespace.
+ * \remark This function sets the RMW error state on failure.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_endpoint_info_index_find_by_node(
+  const rmw_topic_endpoint_info_index_t * index,
+  const char * node_name,
+  const char * node_namespace,
+  const rmw_topic_endpoint_info_t * previous,
+  const rmw_topic_endpoint_info_t ** topic_endpoint_info);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__TOPIC_ENDPOINT_INFO_INDEX_H_
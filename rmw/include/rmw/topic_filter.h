@@ -0,0 +1,122 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__TOPIC_FILTER_H_
+#define RMW__TOPIC_FILTER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/types.h"
+#include "rmw/visibility_control.h"
+
+#if __cplusplus
+extern "C"
+{
+#endif
+
+/// Selection of topics for filtered ROS graph queries.
+/**
+ * A topic is selected if its name matches `pattern`, and it has an endpoint
+ * of kind `endpoint_type`.
+ *
+ * \sa rmw_topic_name_matches() for the pattern syntax.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_topic_filter_s
+{
+  /// Pattern topic names must match, NULL or empty to select all topic names.
+  const char * pattern;
+  /// Kind of endpoint topics must have.
+  /**
+   * `RMW_ENDPOINT_PUBLISHER` selects topics with publishers,
+   * `RMW_ENDPOINT_SUBSCRIPTION` selects topics with subscriptions, and
+   * `RMW_ENDPOINT_INVALID` selects topics with either.
+   */
+  rmw_endpoint_type_t endpoint_type;
+} rmw_topic_filter_t;
+
+/// Return a zero initialized topic filter, which selects all topics.
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_topic_filter_t
+rmw_get_zero_initialized_topic_filter(void);
+
+/// Check whether a topic name matches a pattern.
+/**
+ * Patterns are fully qualified topic names, which may contain wildcards:
+ * - `?` matches any single character but a forward slash,
+ * - `*` matches any sequence of characters without a forward slash, i.e. part of a token,
+ * - `**` matches any sequence of characters, forward slashes included.
+ *
+ * All other characters match themselves.
+ * For instance, `/robot1/` followed by `**` matches all topic names in the `/robot1`
+ * namespace and those nested in it, and `/robot?/camera_*` matches `/robot1/camera_left`
+ * but not `/robot1/camera_left/image`.
+ * An empty pattern matches any topic name.
+ *
+ * Matching backtracks to the last wildcard only, and does not allocate memory.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] pattern null terminated pattern to match against.
+ * \param[in] topic_name null terminated topic name to be matched.
+ * \param[out] matches whether `topic_name` matches `pattern`.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pattern`, `topic_name` or `matches` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_name_matches(const char * pattern, const char * topic_name, bool * matches);
+
+/// Get the length of the literal prefix of a pattern.
+/**
+ * All topic names matching the pattern start with its first `prefix_length` characters,
+ * which precede any wildcard.
+ * rmw implementations keeping topic names sorted may thus only look at the range of names
+ * starting with the prefix, e.g. `/robot1/` for all topic names in the `/robot1` namespace,
+ * and match those.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] pattern null terminated pattern, see rmw_topic_name_matches().
+ * \param[out] prefix_length length of the literal prefix of `pattern`, which is the length
+ *   of `pattern` if it has no wildcards.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pattern` or `prefix_length` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_topic_pattern_get_prefix_length(const char * pattern, size_t * prefix_length);
+
+#if __cplusplus
+}
+#endif
+
+#endif  // RMW__TOPIC_FILTER_H_
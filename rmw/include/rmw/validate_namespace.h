@@ -20,6 +20,8 @@ extern "C"
 {
 #endif
 
+#include "rcutils/types/string_array.h"
+
 #include "rmw/macros.h"
 #include "rmw/types.h"
 #include "rmw/validate_full_topic_name.h"
@@ -121,6 +123,55 @@ rmw_validate_namespace_with_size(
   int * validation_result,
   size_t * invalid_index);
 
+/// Determine if each namespace of an array is valid.
+/**
+ * This is equivalent to calling rmw_validate_namespace() on each string of `namespaces`, or
+ * rmw_validate_namespace_with_size() with `lengths[i]` if `lengths` is not NULL, except that the
+ * arguments are checked once for the whole array, which is only a little faster than such a loop.
+ * The result for `namespaces->data[i]` is stored in `validation_results[i]`, and its invalid index,
+ * if any, in `invalid_indices[i]`, so both arrays must have room for at least `namespaces->size`
+ * elements.
+ * If NULL is passed in for invalid_indices, they will not be set.
+ * As with rmw_validate_namespace(), the invalid index of a valid namespace is not assigned.
+ *
+ * Strings of the array are only read, and results are only written to the slots of their
+ * strings, so large arrays can be split across threads by validating disjoint ranges of them
+ * concurrently, e.g. as arrays with `size` set to the length of the range and `data` pointing
+ * to its first string, along with the matching offsets into the result arrays.
+ *
+ * If a non RMW_RET_OK return value is returned, the RMW error message will be set, and only
+ * the results of the strings before the offending one are stored.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \sa rmw_validate_namespace(const char *, int *, size_t *)
+ *
+ * \param[in] namespaces array of namespaces to be validated
+ * \param[in] lengths array of the lengths of the input strings, or NULL to compute them
+ * \param[out] validation_results array in which the result of each check is stored
+ * \param[out] invalid_indices array of indices of the input strings where an error occurred
+ * \returns `RMW_RET_OK` on successfully running all checks, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `namespaces` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `namespaces` has strings but `namespaces->data` or
+ *   `validation_results` is NULL, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if any of the strings is NULL, or
+ * \returns `RMW_RET_ERROR` when an unspecified error occurs.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_validate_namespaces_batch(
+  const rcutils_string_array_t * namespaces,
+  const size_t * lengths,
+  int * validation_results,
+  size_t * invalid_indices);
+
 /// Return a validation result description, or NULL if RMW_NAMESPACE_VALID.
 /**
  * \param[in] validation_result the result of validation
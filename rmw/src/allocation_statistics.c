@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/allocation_statistics.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+
+#include "./allocation_statistics_impl.h"
+
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+
+typedef struct rmw_atomic_site_statistics_s
+{
+  atomic_uint_least64_t total_count;
+  atomic_uint_least64_t total_bytes;
+  atomic_uint_least64_t live_count;
+  atomic_uint_least64_t live_bytes;
+  atomic_uint_least64_t peak_bytes;
+  atomic_uint_least64_t size_histogram[RMW_ALLOCATION_SIZE_HISTOGRAM_BUCKETS];
+} rmw_atomic_site_statistics_t;
+
+static rmw_atomic_site_statistics_t g_sites[RMW_ALLOCATION_SITE_COUNT];
+static atomic_uint_least64_t g_live_bytes;
+static atomic_uint_least64_t g_peak_bytes;
+
+static size_t
+histogram_bucket(size_t size)
+{
+  size_t bucket = 0u;
+  while (size > 1u && bucket < RMW_ALLOCATION_SIZE_HISTOGRAM_BUCKETS - 1u) {
+    size >>= 1u;
+    ++bucket;
+  }
+  return bucket;
+}
+
+static void
+raise_peak(atomic_uint_least64_t * peak, uint64_t value)
+{
+  uint64_t current = atomic_load_explicit(peak, memory_order_relaxed);
+  while (value > current &&
+    !atomic_compare_exchange_weak_explicit(
+      peak, &current, value, memory_order_relaxed, memory_order_relaxed))
+  {
+    // current was reloaded by the failed exchange, try again.
+  }
+}
+
+static uint64_t
+load(atomic_uint_least64_t * counter)
+{
+  return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+void
+rmw_allocation_statistics_record_allocate(rmw_allocation_site_t site, size_t size)
+{
+  rmw_atomic_site_statistics_t * stats = &g_sites[site];
+  atomic_fetch_add_explicit(&stats->total_count, 1u, memory_order_relaxed);
+  atomic_fetch_add_explicit(&stats->total_bytes, size, memory_order_relaxed);
+  atomic_fetch_add_explicit(&stats->live_count, 1u, memory_order_relaxed);
+  atomic_fetch_add_explicit(
+    &stats->size_histogram[histogram_bucket(size)], 1u, memory_order_relaxed);
+  raise_peak(
+    &stats->peak_bytes,
+    atomic_fetch_add_explicit(&stats->live_bytes, size, memory_order_relaxed) + size);
+  raise_peak(
+    &g_peak_bytes,
+    atomic_fetch_add_explicit(&g_live_bytes, size, memory_order_relaxed) + size);
+}
+
+void
+rmw_allocation_statistics_record_free(rmw_allocation_site_t site, size_t size)
+{
+  rmw_atomic_site_statistics_t * stats = &g_sites[site];
+  atomic_fetch_sub_explicit(&stats->live_count, 1u, memory_order_relaxed);
+  atomic_fetch_sub_explicit(&stats->live_bytes, size, memory_order_relaxed);
+  atomic_fetch_sub_explicit(&g_live_bytes, size, memory_order_relaxed);
+}
+
+#endif  // RMW_ENABLE_ALLOCATION_STATISTICS
+
+bool
+rmw_allocation_statistics_are_enabled(void)
+{
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+  return true;
+#else
+  return false;
+#endif
+}
+
+rmw_ret_t
+rmw_get_allocation_statistics(rmw_allocation_statistics_t * statistics)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(statistics, RMW_RET_INVALID_ARGUMENT);
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+  for (size_t i = 0u; i < RMW_ALLOCATION_SITE_COUNT; ++i) {
+    rmw_atomic_site_statistics_t * stats = &g_sites[i];
+    rmw_allocation_site_statistics_t * snapshot = &statistics->sites[i];
+    snapshot->total_count = load(&stats->total_count);
+    snapshot->total_bytes = load(&stats->total_bytes);
+    snapshot->live_count = load(&stats->live_count);
+    snapshot->live_bytes = load(&stats->live_bytes);
+    snapshot->peak_bytes = load(&stats->peak_bytes);
+    for (size_t j = 0u; j < RMW_ALLOCATION_SIZE_HISTOGRAM_BUCKETS; ++j) {
+      snapshot->size_histogram[j] = load(&stats->size_histogram[j]);
+    }
+  }
+  statistics->live_bytes = load(&g_live_bytes);
+  statistics->peak_bytes = load(&g_peak_bytes);
+  return RMW_RET_OK;
+#else
+  RMW_SET_ERROR_MSG("rmw was built without allocation statistics");
+  return RMW_RET_UNSUPPORTED;
+#endif
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ALLOCATION_STATISTICS_IMPL_H_
+#define ALLOCATION_STATISTICS_IMPL_H_
+
+#include <stddef.h>
+
+#include "rmw/allocation_statistics.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+
+/// Account for an allocation of `size` bytes at the given site.
+RMW_LOCAL
+void
+rmw_allocation_statistics_record_allocate(rmw_allocation_site_t site, size_t size);
+
+/// Account for freeing an allocation of `size` bytes made at the given site.
+RMW_LOCAL
+void
+rmw_allocation_statistics_record_free(rmw_allocation_site_t site, size_t size);
+
+#else
+
+#define rmw_allocation_statistics_record_allocate(site, size) ((void)(site), (void)(size))
+#define rmw_allocation_statistics_record_free(site, size) ((void)(site), (void)(size))
+
+#endif  // RMW_ENABLE_ALLOCATION_STATISTICS
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ALLOCATION_STATISTICS_IMPL_H_
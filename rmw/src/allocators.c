@@ -14,128 +14,269 @@
 
 #include "rmw/allocators.h"
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
-#include <string.h>
 
 #include <rcutils/allocator.h>
+#include <rcutils/stdatomic_helper.h>
 
+#include "rmw/allocation_statistics.h"
+#include "rmw/entity_pool.h"
+#include "rmw/error_handling.h"
 #include "rmw/types.h"
 
-void *
-rmw_allocate(size_t size)
+#include "./allocation_statistics_impl.h"
+#include "./entity_pool_impl.h"
+
+// Zero initialized until rmw_set_default_allocator() is called.
+static rcutils_allocator_t g_allocator;
+static bool g_allocator_is_set = false;
+
+static atomic_uint_least64_t g_allocation_count;
+static atomic_uint_least64_t g_deallocation_count;
+
+static rcutils_allocator_t
+get_allocator(void)
+{
+  return g_allocator_is_set ? g_allocator : rcutils_get_default_allocator();
+}
+
+rmw_ret_t
+rmw_set_default_allocator(const rcutils_allocator_t * allocator)
 {
-  // Could be overridden with a general purpose allocator
-  rcutils_allocator_t allocator = rcutils_get_default_allocator();
-  void * ptr = allocator.allocate(size, allocator.state);
+  if (!allocator) {
+    g_allocator_is_set = false;
+    g_allocator = rcutils_get_zero_initialized_allocator();
+    return RMW_RET_OK;
+  }
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "invalid allocator", return RMW_RET_INVALID_ARGUMENT);
+  g_allocator = *allocator;
+  g_allocator_is_set = true;
+  return RMW_RET_OK;
+}
+
+rcutils_allocator_t
+rmw_get_default_allocator(void)
+{
+  return get_allocator();
+}
+
+rmw_ret_t
+rmw_get_allocation_counts(rmw_allocation_counts_t * counts)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(counts, RMW_RET_INVALID_ARGUMENT);
+  counts->allocations = rcutils_atomic_load_uint64_t(&g_allocation_count);
+  counts->deallocations = rcutils_atomic_load_uint64_t(&g_deallocation_count);
+  return RMW_RET_OK;
+}
+
+static void *
+allocate_block(size_t size, bool zero_initialize)
+{
+  rcutils_allocator_t allocator = get_allocator();
+  // zero_allocate() lets the allocator skip clearing memory which is known to be
+  // zeroed already, e.g. fresh pages, which a plain memset() cannot do.
+  void * ptr = zero_initialize ?
+    allocator.zero_allocate(1u, size, allocator.state) :
+    allocator.allocate(size, allocator.state);
   if (ptr) {
-    memset(ptr, 0, size);
+    rcutils_atomic_fetch_add_uint64_t(&g_allocation_count, 1u);
   }
   return ptr;
 }
 
+static void
+free_block(void * pointer)
+{
+  rcutils_allocator_t allocator = get_allocator();
+  allocator.deallocate(pointer, allocator.state);
+  rcutils_atomic_fetch_add_uint64_t(&g_deallocation_count, 1u);
+}
+
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+// Size header stored in front of every block handed out by rmw_allocate(),
+// padded so that the block itself keeps the allocator's alignment.
+typedef union rmw_allocation_header_u
+{
+  size_t size;
+  long double ld;
+  void * ptr;
+  uint64_t u64;
+} rmw_allocation_header_t;
+#endif
+
+static void *
+rmw_allocate_impl(size_t size, bool zero_initialize)
+{
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+  if (size > SIZE_MAX - sizeof(rmw_allocation_header_t)) {
+    return NULL;
+  }
+  rmw_allocation_header_t * header = (rmw_allocation_header_t *)allocate_block(
+    sizeof(rmw_allocation_header_t) + size, zero_initialize);
+  if (!header) {
+    return NULL;
+  }
+  header->size = size;
+  rmw_allocation_statistics_record_allocate(RMW_ALLOCATION_SITE_GENERIC, size);
+  return header + 1;
+#else
+  return allocate_block(size, zero_initialize);
+#endif
+}
+
+void *
+rmw_allocate(size_t size)
+{
+  return rmw_allocate_impl(size, true);
+}
+
+void *
+rmw_allocate_uninitialized(size_t size)
+{
+  return rmw_allocate_impl(size, false);
+}
+
 void
 rmw_free(void * pointer)
 {
-  // Should have a corresponding override with rmw_allocate
-  rcutils_allocator_t allocator = rcutils_get_default_allocator();
-  allocator.deallocate(pointer, allocator.state);
+  if (!pointer) {
+    return;
+  }
+#ifdef RMW_ENABLE_ALLOCATION_STATISTICS
+  rmw_allocation_header_t * header = (rmw_allocation_header_t *)pointer - 1;
+  rmw_allocation_statistics_record_free(RMW_ALLOCATION_SITE_GENERIC, header->size);
+  free_block(header);
+#else
+  free_block(pointer);
+#endif
+}
+
+static const rmw_allocation_site_t g_entity_sites[RMW_ENTITY_POOL_TYPE_COUNT] = {
+  RMW_ALLOCATION_SITE_NODE,
+  RMW_ALLOCATION_SITE_PUBLISHER,
+  RMW_ALLOCATION_SITE_SUBSCRIPTION,
+  RMW_ALLOCATION_SITE_GUARD_CONDITION,
+  RMW_ALLOCATION_SITE_CLIENT,
+  RMW_ALLOCATION_SITE_SERVICE,
+  RMW_ALLOCATION_SITE_WAIT_SET,
+};
+
+static void *
+rmw_entity_allocate(rmw_entity_pool_type_t type, size_t size)
+{
+  // Served from the preallocated pool if any, see rmw_entity_pools_init()
+  void * ptr = rmw_entity_pool_allocate(type);
+  if (!ptr) {
+    ptr = allocate_block(size, true);
+  }
+  if (ptr) {
+    rmw_allocation_statistics_record_allocate(g_entity_sites[type], size);
+  }
+  return ptr;
+}
+
+static void
+rmw_entity_free(rmw_entity_pool_type_t type, void * pointer, size_t size)
+{
+  if (!pointer) {
+    return;
+  }
+  rmw_allocation_statistics_record_free(g_entity_sites[type], size);
+  if (!rmw_entity_pool_release(type, pointer)) {
+    free_block(pointer);
+  }
 }
 
 rmw_node_t *
 rmw_node_allocate(void)
 {
-  // Could be overridden with custom (maybe static) node struct allocator
-  return (rmw_node_t *)rmw_allocate(sizeof(rmw_node_t));
+  return (rmw_node_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_NODE, sizeof(rmw_node_t));
 }
 
 void
 rmw_node_free(rmw_node_t * node)
 {
-  // Should have matching overide with rmw_node_allocate
-  rmw_free(node);
+  rmw_entity_free(RMW_ENTITY_POOL_NODE, node, sizeof(*node));
 }
 
 rmw_publisher_t *
 rmw_publisher_allocate(void)
 {
-  // Could be overridden with custom (maybe static) publisher struct allocator
-  return (rmw_publisher_t *)rmw_allocate(sizeof(rmw_publisher_t));
+  return (rmw_publisher_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_PUBLISHER, sizeof(rmw_publisher_t));
 }
 
 void
 rmw_publisher_free(rmw_publisher_t * publisher)
 {
-  // Should have matching overide with rmw_publisher_allocate
-  rmw_free(publisher);
+  rmw_entity_free(RMW_ENTITY_POOL_PUBLISHER, publisher, sizeof(*publisher));
 }
 
 rmw_subscription_t *
 rmw_subscription_allocate(void)
 {
-  // Could be overridden with custom (maybe static) subscription struct allocator
-  return (rmw_subscription_t *)rmw_allocate(sizeof(rmw_subscription_t));
+  return (rmw_subscription_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_SUBSCRIPTION, sizeof(rmw_subscription_t));
 }
 
 void
 rmw_subscription_free(rmw_subscription_t * subscription)
 {
-  // Should have matching overide with rmw_subscription_allocate
-  rmw_free(subscription);
+  rmw_entity_free(RMW_ENTITY_POOL_SUBSCRIPTION, subscription, sizeof(*subscription));
 }
 
 rmw_guard_condition_t *
 rmw_guard_condition_allocate(void)
 {
-  // Could be overridden with custom (maybe static) guard_condition
-  // struct allocator
-  return (rmw_guard_condition_t *)rmw_allocate(sizeof(rmw_guard_condition_t));
+  return (rmw_guard_condition_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_GUARD_CONDITION, sizeof(rmw_guard_condition_t));
 }
 
 void
 rmw_guard_condition_free(rmw_guard_condition_t * guard_condition)
 {
-  // Should have matching overide with rmw_guard_condition_allocate
-  rmw_free(guard_condition);
+  rmw_entity_free(RMW_ENTITY_POOL_GUARD_CONDITION, guard_condition, sizeof(*guard_condition));
 }
 
 rmw_client_t *
 rmw_client_allocate(void)
 {
-  // Could be overridden with custom (maybe static) client struct allocator
-  return (rmw_client_t *)rmw_allocate(sizeof(rmw_client_t));
+  return (rmw_client_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_CLIENT, sizeof(rmw_client_t));
 }
 
 void
 rmw_client_free(rmw_client_t * client)
 {
-  // Should have matching overide with rmw_client_allocate
-  rmw_free(client);
+  rmw_entity_free(RMW_ENTITY_POOL_CLIENT, client, sizeof(*client));
 }
 
 rmw_service_t *
 rmw_service_allocate(void)
 {
-  // Could be overridden with custom (maybe static) client struct allocator
-  return (rmw_service_t *)rmw_allocate(sizeof(rmw_service_t));
+  return (rmw_service_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_SERVICE, sizeof(rmw_service_t));
 }
 
 void
 rmw_service_free(rmw_service_t * service)
 {
-  // Should have matching overide with rmw_service_allocate
-  rmw_free(service);
+  rmw_entity_free(RMW_ENTITY_POOL_SERVICE, service, sizeof(*service));
 }
 
 rmw_wait_set_t *
 rmw_wait_set_allocate(void)
 {
-  // Could be overridden with custom (maybe static) client struct allocator
-  return (rmw_wait_set_t *)rmw_allocate(sizeof(rmw_wait_set_t));
+  return (rmw_wait_set_t *)rmw_entity_allocate(
+    RMW_ENTITY_POOL_WAIT_SET, sizeof(rmw_wait_set_t));
 }
 
 void
 rmw_wait_set_free(rmw_wait_set_t * wait_set)
 {
-  // Should have matching overide with rmw_wait_set_allocate
-  rmw_free(wait_set);
+  rmw_entity_free(RMW_ENTITY_POOL_WAIT_SET, wait_set, sizeof(*wait_set));
 }
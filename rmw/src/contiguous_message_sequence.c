@@ -0,0 +1,261 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/contiguous_message_sequence.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rmw/error_handling.h"
+
+// Messages are spaced by a multiple of the largest fundamental alignment of
+// the supported platforms, so that every message in the slab is well aligned.
+#define MESSAGE_STRIDE_ALIGNMENT 16u
+
+static size_t
+align_up(size_t value, size_t alignment)
+{
+  return (value + alignment - 1u) / alignment * alignment;
+}
+
+static void *
+align_pointer_up(void * pointer, size_t alignment)
+{
+  return (void *)align_up((uintptr_t)pointer, alignment);
+}
+
+// Adds `size` to `*total`, returning false on overflow.
+static bool
+add_size(size_t * total, size_t size)
+{
+  if (size > SIZE_MAX - *total) {
+    return false;
+  }
+  *total += size;
+  return true;
+}
+
+// Multiplies `count` by `size` into `*product`, returning false on overflow.
+static bool
+mul_size(size_t * product, size_t count, size_t size)
+{
+  if (size != 0u && count > SIZE_MAX / size) {
+    return false;
+  }
+  *product = count * size;
+  return true;
+}
+
+rmw_contiguous_message_sequence_t
+rmw_get_zero_initialized_contiguous_message_sequence(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_contiguous_message_sequence_t contiguous_message_sequence;
+  return contiguous_message_sequence;
+}
+
+rmw_ret_t
+rmw_contiguous_message_sequence_init(
+  rmw_contiguous_message_sequence_t * sequence,
+  size_t capacity,
+  size_t message_size,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  if (0u == message_size) {
+    RMW_SET_ERROR_MSG("message_size must be greater than zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  const size_t message_stride = align_up(message_size, MESSAGE_STRIDE_ALIGNMENT);
+  void * storage = NULL;
+  void * messages = NULL;
+  void ** entries = NULL;
+  if (capacity > 0u) {
+    // Slab first, for its alignment, then the entries pointing into it.
+    size_t slab_size = 0u;
+    size_t entries_size = 0u;
+    size_t storage_size = RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT - 1u;
+    if (message_stride < message_size ||
+      !mul_size(&slab_size, capacity, message_stride) ||
+      !mul_size(&entries_size, capacity, sizeof(void *)) ||
+      !add_size(&storage_size, slab_size) ||
+      !add_size(&storage_size, entries_size))
+    {
+      RMW_SET_ERROR_MSG("contiguous message sequence size overflows");
+      return RMW_RET_BAD_ALLOC;
+    }
+    storage = allocator->zero_allocate(1u, storage_size, allocator->state);
+    if (NULL == storage) {
+      RMW_SET_ERROR_MSG("failed to allocate memory for contiguous message sequence");
+      return RMW_RET_BAD_ALLOC;
+    }
+    messages = align_pointer_up(storage, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT);
+    entries = (void **)((uint8_t *)messages + slab_size);
+    for (size_t i = 0u; i < capacity; ++i) {
+      entries[i] = (uint8_t *)messages + i * message_stride;
+    }
+  }
+
+  sequence->sequence.data = entries;
+  sequence->sequence.size = 0u;
+  sequence->sequence.capacity = capacity;
+  sequence->sequence.allocator = allocator;
+  sequence->messages = messages;
+  sequence->message_size = message_size;
+  sequence->message_stride = message_stride;
+  sequence->storage = storage;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_contiguous_message_sequence_fini(rmw_contiguous_message_sequence_t * sequence)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != sequence->storage) {
+    RCUTILS_CHECK_ALLOCATOR(sequence->sequence.allocator, return RMW_RET_INVALID_ARGUMENT);
+    sequence->sequence.allocator->deallocate(
+      sequence->storage, sequence->sequence.allocator->state);
+  }
+
+  *sequence = rmw_get_zero_initialized_contiguous_message_sequence();
+
+  return RMW_RET_OK;
+}
+
+rmw_message_info_soa_sequence_t
+rmw_get_zero_initialized_message_info_soa_sequence(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_message_info_soa_sequence_t message_info_soa_sequence;
+  return message_info_soa_sequence;
+}
+
+rmw_ret_t
+rmw_message_info_soa_sequence_init(
+  rmw_message_info_soa_sequence_t * sequence,
+  size_t capacity,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  enum
+  {
+    SOURCE_TIMESTAMPS = 0,
+    RECEIVED_TIMESTAMPS,
+    PUBLICATION_SEQUENCE_NUMBERS,
+    RECEPTION_SEQUENCE_NUMBERS,
+    PUBLISHER_GIDS,
+    FROM_INTRA_PROCESS,
+    ARRAY_COUNT
+  };
+  const size_t element_sizes[ARRAY_COUNT] = {
+    sizeof(rmw_time_point_value_t),
+    sizeof(rmw_time_point_value_t),
+    sizeof(uint64_t),
+    sizeof(uint64_t),
+    sizeof(rmw_gid_t),
+    sizeof(bool),
+  };
+  uint8_t * arrays[ARRAY_COUNT] = {NULL};
+  void * storage = NULL;
+  if (capacity > 0u) {
+    // Each array starts on its own cache line.
+    size_t offsets[ARRAY_COUNT];
+    size_t storage_size = 0u;
+    for (size_t i = 0u; i < ARRAY_COUNT; ++i) {
+      size_t array_size = 0u;
+      offsets[i] = storage_size;
+      if (!mul_size(&array_size, capacity, element_sizes[i]) ||
+        array_size > SIZE_MAX - RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT ||
+        !add_size(&storage_size, align_up(array_size, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT)))
+      {
+        RMW_SET_ERROR_MSG("message info sequence size overflows");
+        return RMW_RET_BAD_ALLOC;
+      }
+    }
+    if (!add_size(&storage_size, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT - 1u)) {
+      RMW_SET_ERROR_MSG("message info sequence size overflows");
+      return RMW_RET_BAD_ALLOC;
+    }
+    storage = allocator->zero_allocate(1u, storage_size, allocator->state);
+    if (NULL == storage) {
+      RMW_SET_ERROR_MSG("failed to allocate memory for message info sequence");
+      return RMW_RET_BAD_ALLOC;
+    }
+    uint8_t * base = align_pointer_up(storage, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT);
+    for (size_t i = 0u; i < ARRAY_COUNT; ++i) {
+      arrays[i] = base + offsets[i];
+    }
+  }
+
+  sequence->source_timestamps = (rmw_time_point_value_t *)arrays[SOURCE_TIMESTAMPS];
+  sequence->received_timestamps = (rmw_time_point_value_t *)arrays[RECEIVED_TIMESTAMPS];
+  sequence->publication_sequence_numbers = (uint64_t *)arrays[PUBLICATION_SEQUENCE_NUMBERS];
+  sequence->reception_sequence_numbers = (uint64_t *)arrays[RECEPTION_SEQUENCE_NUMBERS];
+  sequence->publisher_gids = (rmw_gid_t *)arrays[PUBLISHER_GIDS];
+  sequence->from_intra_process = (bool *)arrays[FROM_INTRA_PROCESS];
+  sequence->size = 0u;
+  sequence->capacity = capacity;
+  sequence->allocator = allocator;
+  sequence->storage = storage;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_soa_sequence_fini(rmw_message_info_soa_sequence_t * sequence)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != sequence->storage) {
+    RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
+    sequence->allocator->deallocate(sequence->storage, sequence->allocator->state);
+  }
+
+  *sequence = rmw_get_zero_initialized_message_info_soa_sequence();
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_soa_sequence_copy_from(
+  const rmw_message_info_sequence_t * src,
+  rmw_message_info_soa_sequence_t * dst)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(src, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(dst, RMW_RET_INVALID_ARGUMENT);
+  if (dst->capacity < src->size) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "destination capacity %zu is less than source size %zu", dst->capacity, src->size);
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  for (size_t i = 0u; i < src->size; ++i) {
+    const rmw_message_info_t * info = &src->data[i];
+    dst->source_timestamps[i] = info->source_timestamp;
+    dst->received_timestamps[i] = info->received_timestamp;
+    dst->publication_sequence_numbers[i] = info->publication_sequence_number;
+    dst->reception_sequence_numbers[i] = info->reception_sequence_number;
+    dst->publisher_gids[i] = info->publisher_gid;
+    dst->from_intra_process[i] = info->from_intra_process;
+  }
+  dst->size = src->size;
+
+  return RMW_RET_OK;
+}
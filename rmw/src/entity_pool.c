@@ -0,0 +1,236 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/entity_pool.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rcutils/allocator.h"
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/types.h"
+
+#include "./entity_pool_impl.h"
+#include "./spin_lock_impl.h"
+
+// Blocks are rounded up to a multiple of this, so that every block in a slab
+// is suitably aligned for any entity struct.
+typedef union rmw_entity_pool_max_align_u
+{
+  long double ld;
+  void * ptr;
+  uint64_t u64;
+} rmw_entity_pool_max_align_t;
+
+typedef struct rmw_entity_pool_s
+{
+  // Guards every other member.
+  atomic_bool lock;
+  // Number of rmw_entity_pools_init() calls not yet matched by rmw_entity_pools_fini().
+  size_t init_count;
+  size_t block_size;
+  size_t capacity;
+  size_t in_use;
+  // Contiguous storage for capacity * block_size bytes, NULL if the pool is disabled.
+  uint8_t * slab;
+  // Singly linked list threaded through the first word of each free block.
+  void * free_list;
+  rcutils_allocator_t allocator;
+} rmw_entity_pool_t;
+
+static rmw_entity_pool_t g_entity_pools[RMW_ENTITY_POOL_TYPE_COUNT];
+
+static const size_t g_entity_sizes[RMW_ENTITY_POOL_TYPE_COUNT] = {
+  sizeof(rmw_node_t),
+  sizeof(rmw_publisher_t),
+  sizeof(rmw_subscription_t),
+  sizeof(rmw_guard_condition_t),
+  sizeof(rmw_client_t),
+  sizeof(rmw_service_t),
+  sizeof(rmw_wait_set_t),
+};
+
+static bool
+is_valid_pool_type(rmw_entity_pool_type_t type)
+{
+  return (int)type >= 0 && type < RMW_ENTITY_POOL_TYPE_COUNT;
+}
+
+// Must be called with the pool locked and its slab unset.
+static rmw_ret_t
+setup_pool(
+  rmw_entity_pool_t * pool,
+  size_t entity_size,
+  size_t capacity,
+  const rcutils_allocator_t * allocator)
+{
+  const size_t alignment = sizeof(rmw_entity_pool_max_align_t);
+  const size_t block_size = ((entity_size + alignment - 1u) / alignment) * alignment;
+  if (capacity > SIZE_MAX / block_size) {
+    RMW_SET_ERROR_MSG("entity pool capacity overflows");
+    return RMW_RET_BAD_ALLOC;
+  }
+  uint8_t * slab = allocator->allocate(capacity * block_size, allocator->state);
+  if (!slab) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for entity pool");
+    return RMW_RET_BAD_ALLOC;
+  }
+  // Thread the free list in address order, so that consecutive allocations
+  // hand out neighbouring blocks.
+  void * next = NULL;
+  for (size_t i = capacity; i > 0u; --i) {
+    void * block = slab + (i - 1u) * block_size;
+    memcpy(block, &next, sizeof(next));
+    next = block;
+  }
+  pool->block_size = block_size;
+  pool->capacity = capacity;
+  pool->in_use = 0u;
+  pool->slab = slab;
+  pool->free_list = next;
+  pool->allocator = *allocator;
+  return RMW_RET_OK;
+}
+
+// Must be called with the pool locked and no block in use.
+static void
+teardown_pool(rmw_entity_pool_t * pool)
+{
+  pool->allocator.deallocate(pool->slab, pool->allocator.state);
+  pool->block_size = 0u;
+  pool->capacity = 0u;
+  pool->slab = NULL;
+  pool->free_list = NULL;
+}
+
+rmw_entity_pool_options_t
+rmw_get_zero_initialized_entity_pool_options(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_entity_pool_options_t options;
+  return options;
+}
+
+rmw_ret_t
+rmw_entity_pools_init(
+  const rmw_entity_pool_options_t * options,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(options, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "invalid allocator", return RMW_RET_INVALID_ARGUMENT);
+
+  for (int i = 0; i < RMW_ENTITY_POOL_TYPE_COUNT; ++i) {
+    rmw_entity_pool_t * pool = &g_entity_pools[i];
+    rmw_spin_lock(&pool->lock);
+    if (0u == pool->init_count && options->capacity[i] > 0u) {
+      rmw_ret_t ret = setup_pool(pool, g_entity_sizes[i], options->capacity[i], allocator);
+      if (RMW_RET_OK != ret) {
+        rmw_spin_unlock(&pool->lock);
+        // Roll back the references taken so far.
+        for (int j = i - 1; j >= 0; --j) {
+          rmw_entity_pool_t * prev = &g_entity_pools[j];
+          rmw_spin_lock(&prev->lock);
+          if (0u == --prev->init_count && prev->slab) {
+            teardown_pool(prev);
+          }
+          rmw_spin_unlock(&prev->lock);
+        }
+        return ret;
+      }
+    }
+    ++pool->init_count;
+    rmw_spin_unlock(&pool->lock);
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_entity_pools_fini(void)
+{
+  rmw_ret_t ret = RMW_RET_OK;
+  for (int i = 0; i < RMW_ENTITY_POOL_TYPE_COUNT; ++i) {
+    rmw_entity_pool_t * pool = &g_entity_pools[i];
+    rmw_spin_lock(&pool->lock);
+    if (pool->init_count > 0u) {
+      if (1u == pool->init_count && pool->in_use > 0u) {
+        RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "entity pool %d still has %zu blocks in use", i, pool->in_use);
+        ret = RMW_RET_ERROR;
+      } else {
+        if (0u == --pool->init_count && pool->slab) {
+          teardown_pool(pool);
+        }
+      }
+    }
+    rmw_spin_unlock(&pool->lock);
+  }
+  return ret;
+}
+
+rmw_ret_t
+rmw_entity_pool_get_usage(rmw_entity_pool_type_t type, size_t * in_use, size_t * capacity)
+{
+  if (!is_valid_pool_type(type)) {
+    RMW_SET_ERROR_MSG("invalid entity pool type");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(in_use, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(capacity, RMW_RET_INVALID_ARGUMENT);
+  rmw_entity_pool_t * pool = &g_entity_pools[type];
+  rmw_spin_lock(&pool->lock);
+  *in_use = pool->in_use;
+  *capacity = pool->capacity;
+  rmw_spin_unlock(&pool->lock);
+  return RMW_RET_OK;
+}
+
+void *
+rmw_entity_pool_allocate(rmw_entity_pool_type_t type)
+{
+  rmw_entity_pool_t * pool = &g_entity_pools[type];
+  rmw_spin_lock(&pool->lock);
+  void * block = pool->free_list;
+  if (block) {
+    memcpy(&pool->free_list, block, sizeof(pool->free_list));
+    ++pool->in_use;
+  }
+  rmw_spin_unlock(&pool->lock);
+  if (block) {
+    memset(block, 0, g_entity_sizes[type]);
+  }
+  return block;
+}
+
+bool
+rmw_entity_pool_release(rmw_entity_pool_type_t type, void * pointer)
+{
+  rmw_entity_pool_t * pool = &g_entity_pools[type];
+  const uintptr_t address = (uintptr_t)pointer;
+  rmw_spin_lock(&pool->lock);
+  const uintptr_t begin = (uintptr_t)pool->slab;
+  const uintptr_t end = begin + pool->capacity * pool->block_size;
+  const bool owned = NULL != pool->slab && address >= begin && address < end;
+  if (owned) {
+    memcpy(pointer, &pool->free_list, sizeof(pool->free_list));
+    pool->free_list = pointer;
+    --pool->in_use;
+  }
+  rmw_spin_unlock(&pool->lock);
+  return owned;
+}
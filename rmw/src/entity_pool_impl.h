@@ -0,0 +1,50 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ENTITY_POOL_IMPL_H_
+#define ENTITY_POOL_IMPL_H_
+
+#include <stdbool.h>
+
+#include "rmw/entity_pool.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Pop a zeroed block from the given pool.
+/**
+ * \return pointer to the block, or
+ * \return `NULL` if the pool is disabled or exhausted.
+ */
+RMW_LOCAL
+void *
+rmw_entity_pool_allocate(rmw_entity_pool_type_t type);
+
+/// Push a block back onto the given pool, if it was allocated from it.
+/**
+ * \return `true` if `pointer` belonged to the pool and was released, or
+ * \return `false` if it did not, in which case the caller must free it.
+ */
+RMW_LOCAL
+bool
+rmw_entity_pool_release(rmw_entity_pool_type_t type, void * pointer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ENTITY_POOL_IMPL_H_
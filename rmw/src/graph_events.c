@@ -0,0 +1,82 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/graph_events.h"
+
+#include <stdint.h>
+
+#include "rmw/error_handling.h"
+
+rmw_graph_event_array_t
+rmw_get_zero_initialized_graph_event_array(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_graph_event_array_t zero;
+  return zero;
+}
+
+rmw_ret_t
+rmw_graph_event_array_check_zero(const rmw_graph_event_array_t * graph_event_array)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(graph_event_array, RMW_RET_INVALID_ARGUMENT);
+  if (
+    graph_event_array->size != 0u || graph_event_array->events != NULL ||
+    graph_event_array->generation != 0u || graph_event_array->history_truncated)
+  {
+    RMW_SET_ERROR_MSG("graph_event_array is not zeroed");
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_graph_event_array_init_with_size(
+  rmw_graph_event_array_t * graph_event_array,
+  size_t size,
+  rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(graph_event_array, RMW_RET_INVALID_ARGUMENT);
+  if (RMW_RET_OK != rmw_graph_event_array_check_zero(graph_event_array)) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (size > SIZE_MAX / sizeof(rmw_graph_event_t)) {
+    RMW_SET_ERROR_MSG("graph_event_array size is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_graph_event_t * events =
+    allocator->zero_allocate(size, sizeof(rmw_graph_event_t), allocator->state);
+  if (!events && size != 0u) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for graph events");
+    return RMW_RET_BAD_ALLOC;
+  }
+  graph_event_array->events = events;
+  graph_event_array->size = size;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_graph_event_array_fini(
+  rmw_graph_event_array_t * graph_event_array,
+  rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(graph_event_array, RMW_RET_INVALID_ARGUMENT);
+  // Event strings belong to the rmw implementation
+  allocator->deallocate(graph_event_array->events, allocator->state);
+  *graph_event_array = rmw_get_zero_initialized_graph_event_array();
+  return RMW_RET_OK;
+}
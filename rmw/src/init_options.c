@@ -34,6 +34,7 @@ rmw_get_zero_initialized_init_options(void)
     .impl = NULL,
     .instance_id = 0,
     .enclave = NULL,
+    .entity_pool_options = {{0}},
     .security_options = {RMW_SECURITY_ENFORCEMENT_PERMISSIVE, NULL},
   };
   return init_option;
@@ -0,0 +1,394 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+// For memfd_create().
+#define _GNU_SOURCE
+#endif
+
+#include "rmw/mapped_serialized_message.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/strerror.h"
+
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/error_handling.h"
+
+struct rmw_mapped_serialized_message_impl_s
+{
+  int fd;
+  // Start of the mapping, NULL if nothing is mapped.
+  uint8_t * address;
+  // Length of the mapping, in bytes.
+  size_t length;
+  // Whether the file was created by rmw_mapped_serialized_message_init(), and may thus be
+  // resized. Files received from other processes may be mapped there too, and must not be
+  // truncated under their feet.
+  bool resizable;
+  rcutils_allocator_t allocator;
+};
+
+rmw_mapped_serialized_message_t
+rmw_get_zero_initialized_mapped_serialized_message(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_mapped_serialized_message_t mapped_serialized_message;
+  return mapped_serialized_message;
+}
+
+#ifndef _WIN32
+
+static void
+set_error_from_errno(const char * what)
+{
+  char error_string[256];
+  rcutils_strerror(error_string, sizeof(error_string));
+  RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("%s: %s", what, error_string);
+}
+
+static uint8_t *
+map(int fd, size_t length, bool writable)
+{
+  // Zero sized mappings are not allowed, map a byte instead.
+  void * address = mmap(
+    NULL, length > 0u ? length : 1u, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+    MAP_SHARED, fd, 0);
+  return MAP_FAILED != address ? address : NULL;
+}
+
+static void
+unmap(uint8_t * address, size_t length)
+{
+  (void)munmap(address, length > 0u ? length : 1u);
+}
+
+static bool
+resize_file(int fd, size_t length)
+{
+  // The mapping must not extend past the end of the file.
+  const off_t file_length = (off_t)(length > 0u ? length : 1u);
+  if (file_length < 0) {
+    return false;
+  }
+  return 0 == ftruncate(fd, file_length);
+}
+
+static void *
+mapped_allocate(size_t size, void * state)
+{
+  rmw_mapped_serialized_message_impl_t * impl = state;
+  if (NULL != impl->address || !impl->resizable) {
+    // The file holds a single buffer, and received files are not resized.
+    return NULL;
+  }
+  if (!resize_file(impl->fd, size)) {
+    return NULL;
+  }
+  impl->address = map(impl->fd, size, true);
+  if (NULL != impl->address) {
+    impl->length = size;
+  }
+  return impl->address;
+}
+
+static void
+mapped_deallocate(void * pointer, void * state)
+{
+  rmw_mapped_serialized_message_impl_t * impl = state;
+  if (NULL == pointer || pointer != impl->address) {
+    return;
+  }
+  unmap(impl->address, impl->length);
+  impl->address = NULL;
+  impl->length = 0u;
+}
+
+static void *
+mapped_reallocate(void * pointer, size_t size, void * state)
+{
+  rmw_mapped_serialized_message_impl_t * impl = state;
+  if (NULL == pointer) {
+    return mapped_allocate(size, state);
+  }
+  if (pointer != impl->address || !impl->resizable) {
+    return NULL;
+  }
+  const size_t old_length = impl->length;
+  // Grow the file before mapping it, and only shrink it once the old mapping is gone,
+  // so that the old mapping stays valid if anything fails.
+  if (size > old_length && !resize_file(impl->fd, size)) {
+    return NULL;
+  }
+  uint8_t * address = map(impl->fd, size, true);
+  if (NULL == address) {
+    if (size > old_length) {
+      (void)resize_file(impl->fd, old_length);
+    }
+    return NULL;
+  }
+  unmap(impl->address, old_length);
+  if (size < old_length) {
+    (void)resize_file(impl->fd, size);
+  }
+  impl->address = address;
+  impl->length = size;
+  return address;
+}
+
+static void *
+mapped_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  if (0u != size_of_element && number_of_elements > SIZE_MAX / size_of_element) {
+    return NULL;
+  }
+  const size_t size = number_of_elements * size_of_element;
+  void * pointer = mapped_allocate(size, state);
+  if (NULL != pointer) {
+    // An existing file may hold anything.
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+static int
+create_anonymous_file(void)
+{
+#ifdef MFD_CLOEXEC
+  return memfd_create("rmw_serialized_message", MFD_CLOEXEC);
+#else
+  // Fall back to a POSIX shared memory object, unlinked right away.
+  // The counter keeps names unique across threads of this process.
+  static atomic_uint_least64_t counter;
+  char name[64];
+  for (int attempt = 0; attempt < 16; ++attempt) {
+    const uint64_t count = rcutils_atomic_fetch_add_uint64_t(&counter, 1u);
+    snprintf(
+      name, sizeof(name), "/rmw_serialized_message_%ld_%llu",
+      (long)getpid(), (unsigned long long)count);
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+      (void)shm_unlink(name);
+      return fd;
+    }
+    if (EEXIST != errno) {
+      break;
+    }
+  }
+  return -1;
+#endif
+}
+
+static rmw_ret_t
+init_impl(
+  rmw_mapped_serialized_message_t * mapped,
+  int fd,
+  bool resizable,
+  const rcutils_allocator_t * allocator)
+{
+  rmw_mapped_serialized_message_impl_t * impl = allocator->allocate(
+    sizeof(rmw_mapped_serialized_message_impl_t), allocator->state);
+  if (NULL == impl) {
+    (void)close(fd);
+    RMW_SET_ERROR_MSG("failed to allocate memory for mapped serialized message");
+    return RMW_RET_BAD_ALLOC;
+  }
+  impl->fd = fd;
+  impl->address = NULL;
+  impl->length = 0u;
+  impl->resizable = resizable;
+  impl->allocator = *allocator;
+  mapped->impl = impl;
+  mapped->serialized_message = rmw_get_zero_initialized_serialized_message();
+  mapped->serialized_message.allocator = rmw_mapped_serialized_message_get_allocator(mapped);
+  return RMW_RET_OK;
+}
+
+static void
+fini_impl(rmw_mapped_serialized_message_t * mapped)
+{
+  rmw_mapped_serialized_message_impl_t * impl = mapped->impl;
+  if (NULL != impl->address) {
+    unmap(impl->address, impl->length);
+  }
+  (void)close(impl->fd);
+  rcutils_allocator_t allocator = impl->allocator;
+  allocator.deallocate(impl, allocator.state);
+  *mapped = rmw_get_zero_initialized_mapped_serialized_message();
+}
+
+#endif
+
+rmw_ret_t
+rmw_mapped_serialized_message_init(
+  rmw_mapped_serialized_message_t * mapped,
+  const char * path,
+  size_t capacity,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(mapped, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+#ifdef _WIN32
+  (void)path;
+  (void)capacity;
+  RMW_SET_ERROR_MSG("memory mapped serialized messages are not supported on Windows");
+  return RMW_RET_UNSUPPORTED;
+#else
+  int fd = NULL != path ?
+    open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) : create_anonymous_file();
+  if (fd < 0) {
+    set_error_from_errno("failed to create file to map");
+    return RMW_RET_ERROR;
+  }
+  rmw_ret_t ret = init_impl(mapped, fd, true, allocator);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  if (capacity > 0u) {
+    rcutils_ret_t rcutils_ret = rmw_serialized_message_resize(
+      &mapped->serialized_message, capacity);
+    if (RCUTILS_RET_OK != rcutils_ret) {
+      fini_impl(mapped);
+      RMW_SET_ERROR_MSG("failed to map serialized message");
+      return rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
+    }
+  }
+  return RMW_RET_OK;
+#endif
+}
+
+rmw_ret_t
+rmw_mapped_serialized_message_init_from_fd(
+  rmw_mapped_serialized_message_t * mapped,
+  int fd,
+  size_t length,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(mapped, RMW_RET_INVALID_ARGUMENT);
+  if (fd < 0) {
+    RMW_SET_ERROR_MSG("fd is negative");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+#ifdef _WIN32
+  (void)length;
+  RMW_SET_ERROR_MSG("memory mapped serialized messages are not supported on Windows");
+  return RMW_RET_UNSUPPORTED;
+#else
+  struct stat file_status;
+  if (0 != fstat(fd, &file_status)) {
+    set_error_from_errno("failed to inspect file to map");
+    return RMW_RET_ERROR;
+  }
+  if ((uintmax_t)length > (uintmax_t)file_status.st_size) {
+    RMW_SET_ERROR_MSG("length is larger than the file");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const int status_flags = fcntl(fd, F_GETFL);
+  if (status_flags < 0) {
+    set_error_from_errno("failed to inspect file descriptor");
+    return RMW_RET_ERROR;
+  }
+  if (O_WRONLY == (status_flags & O_ACCMODE)) {
+    RMW_SET_ERROR_MSG("fd is not open for reading");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  // Payloads handed over by another process are often read-only.
+  const bool writable = O_RDWR == (status_flags & O_ACCMODE);
+  int own_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+  if (own_fd < 0) {
+    set_error_from_errno("failed to duplicate file descriptor");
+    return RMW_RET_ERROR;
+  }
+  rmw_ret_t ret = init_impl(mapped, own_fd, false, allocator);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  if (length > 0u) {
+    // Map what is there, without resizing a file that may be larger.
+    rmw_mapped_serialized_message_impl_t * impl = mapped->impl;
+    impl->address = map(impl->fd, length, writable);
+    if (NULL == impl->address) {
+      fini_impl(mapped);
+      RMW_SET_ERROR_MSG("failed to map serialized message");
+      return RMW_RET_BAD_ALLOC;
+    }
+    impl->length = length;
+    mapped->serialized_message.buffer = impl->address;
+    mapped->serialized_message.buffer_length = length;
+    mapped->serialized_message.buffer_capacity = length;
+  }
+  return RMW_RET_OK;
+#endif
+}
+
+rmw_ret_t
+rmw_mapped_serialized_message_fini(rmw_mapped_serialized_message_t * mapped)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(mapped, RMW_RET_INVALID_ARGUMENT);
+#ifndef _WIN32
+  if (NULL != mapped->impl) {
+    fini_impl(mapped);
+  }
+#endif
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_mapped_serialized_message_get_fd(
+  const rmw_mapped_serialized_message_t * mapped,
+  int * fd)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(mapped, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(fd, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == mapped->impl) {
+    RMW_SET_ERROR_MSG("mapped serialized message is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *fd = mapped->impl->fd;
+
+  return RMW_RET_OK;
+}
+
+rcutils_allocator_t
+rmw_mapped_serialized_message_get_allocator(const rmw_mapped_serialized_message_t * mapped)
+{
+  rcutils_allocator_t allocator = rcutils_get_zero_initialized_allocator();
+#ifndef _WIN32
+  if (NULL == mapped || NULL == mapped->impl) {
+    return allocator;
+  }
+  allocator.allocate = mapped_allocate;
+  allocator.deallocate = mapped_deallocate;
+  allocator.reallocate = mapped_reallocate;
+  allocator.zero_allocate = mapped_zero_allocate;
+  allocator.state = mapped->impl;
+#else
+  (void)mapped;
+#endif
+  return allocator;
+}
@@ -0,0 +1,226 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/message_ring_buffer.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rmw/error_handling.h"
+
+rmw_message_ring_buffer_t
+rmw_get_zero_initialized_message_ring_buffer(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_message_ring_buffer_t message_ring_buffer;
+  return message_ring_buffer;
+}
+
+// Map a position relative to the oldest entry to an index in the data array.
+// Positions never exceed the capacity, so this avoids a division.
+static size_t
+wrap(const rmw_message_ring_buffer_t * ring_buffer, size_t position)
+{
+  const size_t index = ring_buffer->head + position;
+  return index >= ring_buffer->capacity ? index - ring_buffer->capacity : index;
+}
+
+// Move all entries to a new data array of the given capacity, oldest first.
+static rmw_ret_t
+resize(rmw_message_ring_buffer_t * ring_buffer, size_t capacity)
+{
+  rcutils_allocator_t * allocator = ring_buffer->allocator;
+  void ** data = NULL;
+  if (capacity > 0u) {
+    if (capacity > SIZE_MAX / sizeof(void *)) {
+      RMW_SET_ERROR_MSG("message ring buffer capacity overflows");
+      return RMW_RET_BAD_ALLOC;
+    }
+    data = allocator->allocate(sizeof(void *) * capacity, allocator->state);
+    if (NULL == data) {
+      RMW_SET_ERROR_MSG("failed to allocate memory for message ring buffer");
+      return RMW_RET_BAD_ALLOC;
+    }
+    // Entries are at most two runs: up to the end of the array, then from its start.
+    const size_t first_run = ring_buffer->capacity - ring_buffer->head < ring_buffer->size ?
+      ring_buffer->capacity - ring_buffer->head : ring_buffer->size;
+    if (first_run > 0u) {
+      memcpy(data, ring_buffer->data + ring_buffer->head, sizeof(void *) * first_run);
+    }
+    if (ring_buffer->size > first_run) {
+      memcpy(data + first_run, ring_buffer->data, sizeof(void *) * (ring_buffer->size - first_run));
+    }
+  }
+  if (NULL != ring_buffer->data) {
+    allocator->deallocate(ring_buffer->data, allocator->state);
+  }
+  ring_buffer->data = data;
+  ring_buffer->head = 0u;
+  ring_buffer->capacity = capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_init(
+  rmw_message_ring_buffer_t * ring_buffer,
+  size_t capacity,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  rmw_message_ring_buffer_t tmp = rmw_get_zero_initialized_message_ring_buffer();
+  tmp.allocator = allocator;
+  rmw_ret_t ret = resize(&tmp, capacity);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  tmp.reserved = capacity;
+  *ring_buffer = tmp;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_fini(rmw_message_ring_buffer_t * ring_buffer)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != ring_buffer->data) {
+    RCUTILS_CHECK_ALLOCATOR(ring_buffer->allocator, return RMW_RET_INVALID_ARGUMENT);
+    ring_buffer->allocator->deallocate(ring_buffer->data, ring_buffer->allocator->state);
+  }
+
+  *ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_reset(rmw_message_ring_buffer_t * ring_buffer)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+
+  ring_buffer->head = 0u;
+  ring_buffer->size = 0u;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_reserve(rmw_message_ring_buffer_t * ring_buffer, size_t capacity)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(ring_buffer->allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  if (capacity > ring_buffer->capacity) {
+    rmw_ret_t ret = resize(ring_buffer, capacity);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  if (capacity > ring_buffer->reserved) {
+    ring_buffer->reserved = capacity;
+  }
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_push(rmw_message_ring_buffer_t * ring_buffer, void * message)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+
+  if (ring_buffer->size == ring_buffer->capacity) {
+    RCUTILS_CHECK_ALLOCATOR(ring_buffer->allocator, return RMW_RET_INVALID_ARGUMENT);
+    if (ring_buffer->capacity > SIZE_MAX / 2u) {
+      RMW_SET_ERROR_MSG("message ring buffer capacity overflows");
+      return RMW_RET_BAD_ALLOC;
+    }
+    const size_t capacity = ring_buffer->capacity > 0u ? ring_buffer->capacity * 2u : 1u;
+    rmw_ret_t ret = resize(ring_buffer, capacity);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  ring_buffer->data[wrap(ring_buffer, ring_buffer->size)] = message;
+  ++ring_buffer->size;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_push_overwrite(
+  rmw_message_ring_buffer_t * ring_buffer,
+  void * message,
+  void ** evicted)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+  if (0u == ring_buffer->capacity) {
+    RMW_SET_ERROR_MSG("message ring buffer has no capacity");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  void * oldest = NULL;
+  if (ring_buffer->size == ring_buffer->capacity) {
+    // The slot of the oldest entry is the one right after the newest.
+    oldest = ring_buffer->data[ring_buffer->head];
+    ring_buffer->data[ring_buffer->head] = message;
+    ring_buffer->head = wrap(ring_buffer, 1u);
+  } else {
+    ring_buffer->data[wrap(ring_buffer, ring_buffer->size)] = message;
+    ++ring_buffer->size;
+  }
+  if (NULL != evicted) {
+    *evicted = oldest;
+  }
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_ring_buffer_pop(rmw_message_ring_buffer_t * ring_buffer, void ** message)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ring_buffer, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  if (0u == ring_buffer->size) {
+    RMW_SET_ERROR_MSG("message ring buffer is empty");
+    return RMW_RET_ERROR;
+  }
+
+  *message = ring_buffer->data[ring_buffer->head];
+  ring_buffer->head = wrap(ring_buffer, 1u);
+  --ring_buffer->size;
+
+  const size_t capacity = ring_buffer->capacity / 2u;
+  if (ring_buffer->size <= ring_buffer->capacity / 4u && capacity >= ring_buffer->reserved &&
+    rcutils_allocator_is_valid(ring_buffer->allocator))
+  {
+    // Shrinking is an optimization, keep the current array if it fails.
+    if (RMW_RET_OK != resize(ring_buffer, capacity)) {
+      rmw_reset_error();
+    }
+  }
+
+  return RMW_RET_OK;
+}
+
+void *
+rmw_message_ring_buffer_at(const rmw_message_ring_buffer_t * ring_buffer, size_t index)
+{
+  if (NULL == ring_buffer || index >= ring_buffer->size) {
+    return NULL;
+  }
+  return ring_buffer->data[wrap(ring_buffer, index)];
+}
@@ -0,0 +1,308 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./name_scanner_impl.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rmw/validate_full_topic_name.h"
+
+// Pick a kernel at compile time, RMW_NAME_SCANNER_SCALAR forces the portable one.
+#if defined(RMW_NAME_SCANNER_SCALAR)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define NAME_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NAME_SCANNER_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define NAME_SCANNER_NEON
+#endif
+
+// Names are scanned in blocks of this many characters, one bit per character in masks.
+#define BLOCK_SIZE 64u
+// Trailing characters fewer than this many are scanned one at a time rather than padded.
+#define SHORT_TAIL_SIZE 16u
+
+// Character classes, as bit flags.
+#define CHAR_WORD 0x1u
+#define CHAR_SLASH 0x2u
+#define CHAR_DIGIT 0x4u
+
+#if defined(NAME_SCANNER_AVX2) || defined(NAME_SCANNER_SSE2) || defined(NAME_SCANNER_NEON)
+#define NAME_SCANNER_SIMD
+#endif
+
+#define W CHAR_WORD
+#define D (CHAR_WORD | CHAR_DIGIT)
+#define S CHAR_SLASH
+// Classes of all characters: alphanumerics and '_' are W, digits D as well, and '/' is S.
+static const uint8_t g_char_classes[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, S,
+  D, D, D, D, D, D, D, D, D, D, 0, 0, 0, 0, 0, 0,
+  0, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+  W, W, W, W, W, W, W, W, W, W, W, 0, 0, 0, 0, W,
+  0, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+  W, W, W, W, W, W, W, W, W, W, W, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+#undef W
+#undef D
+#undef S
+
+#if defined(NAME_SCANNER_SIMD)
+// Masks of the characters of a block, bit i standing for character i.
+typedef struct block_masks_s
+{
+  uint64_t unallowed;
+  uint64_t slash;
+  uint64_t digit;
+} block_masks_t;
+
+#if defined(NAME_SCANNER_AVX2)
+
+static void
+classify_block(const uint8_t * block, bool allow_forward_slash, block_masks_t * masks)
+{
+  masks->unallowed = masks->slash = masks->digit = 0u;
+  for (size_t offset = 0u; offset < BLOCK_SIZE; offset += 32u) {
+    // Signed compares are fine, as all ranges are within ASCII and other bytes are negative.
+    const __m256i v = _mm256_loadu_si256((const __m256i *)(block + offset));
+    const __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    const __m256i digit = _mm256_and_si256(
+      _mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    const __m256i alpha = _mm256_and_si256(
+      _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    const __m256i slash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'));
+    __m256i allowed = _mm256_or_si256(
+      _mm256_or_si256(digit, alpha), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+    if (allow_forward_slash) {
+      allowed = _mm256_or_si256(allowed, slash);
+    }
+    masks->unallowed |= (uint64_t)(uint32_t)~_mm256_movemask_epi8(allowed) << offset;
+    masks->slash |= (uint64_t)(uint32_t)_mm256_movemask_epi8(slash) << offset;
+    masks->digit |= (uint64_t)(uint32_t)_mm256_movemask_epi8(digit) << offset;
+  }
+}
+
+#elif defined(NAME_SCANNER_SSE2)
+
+static void
+classify_block(const uint8_t * block, bool allow_forward_slash, block_masks_t * masks)
+{
+  masks->unallowed = masks->slash = masks->digit = 0u;
+  for (size_t offset = 0u; offset < BLOCK_SIZE; offset += 16u) {
+    // Signed compares are fine, as all ranges are within ASCII and other bytes are negative.
+    const __m128i v = _mm_loadu_si128((const __m128i *)(block + offset));
+    const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    const __m128i digit = _mm_and_si128(
+      _mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    const __m128i alpha = _mm_and_si128(
+      _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+      _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    const __m128i slash = _mm_cmpeq_epi8(v, _mm_set1_epi8('/'));
+    __m128i allowed = _mm_or_si128(
+      _mm_or_si128(digit, alpha), _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    if (allow_forward_slash) {
+      allowed = _mm_or_si128(allowed, slash);
+    }
+    masks->unallowed |= (uint64_t)(~_mm_movemask_epi8(allowed) & 0xffff) << offset;
+    masks->slash |= (uint64_t)_mm_movemask_epi8(slash) << offset;
+    masks->digit |= (uint64_t)_mm_movemask_epi8(digit) << offset;
+  }
+}
+
+#else  // defined(NAME_SCANNER_NEON)
+
+// Gather the top bit of each lane, all lanes being either 0x00 or 0xff.
+static uint64_t
+movemask(uint8x16_t v)
+{
+  static const uint8_t weights[16] = {
+    1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u, 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u,
+  };
+  const uint8x16_t bits = vandq_u8(v, vld1q_u8(weights));
+  return (uint64_t)vaddv_u8(vget_low_u8(bits)) | ((uint64_t)vaddv_u8(vget_high_u8(bits)) << 8);
+}
+
+static void
+classify_block(const uint8_t * block, bool allow_forward_slash, block_masks_t * masks)
+{
+  masks->unallowed = masks->slash = masks->digit = 0u;
+  for (size_t offset = 0u; offset < BLOCK_SIZE; offset += 16u) {
+    const uint8x16_t v = vld1q_u8(block + offset);
+    const uint8x16_t lower = vorrq_u8(v, vdupq_n_u8(0x20));
+    const uint8x16_t digit = vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9')));
+    const uint8x16_t alpha = vandq_u8(
+      vcgeq_u8(lower, vdupq_n_u8('a')), vcleq_u8(lower, vdupq_n_u8('z')));
+    const uint8x16_t slash = vceqq_u8(v, vdupq_n_u8('/'));
+    uint8x16_t allowed = vorrq_u8(vorrq_u8(digit, alpha), vceqq_u8(v, vdupq_n_u8('_')));
+    if (allow_forward_slash) {
+      allowed = vorrq_u8(allowed, slash);
+    }
+    masks->unallowed |= movemask(vmvnq_u8(allowed)) << offset;
+    masks->slash |= movemask(slash) << offset;
+    masks->digit |= movemask(digit) << offset;
+  }
+}
+
+#endif
+
+static size_t
+count_trailing_zeros(uint64_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return (size_t)__builtin_ctzll(mask);
+#else
+  size_t count = 0u;
+  while (0u == (mask & 1u)) {
+    mask >>= 1u;
+    ++count;
+  }
+  return count;
+#endif
+}
+#endif  // defined(NAME_SCANNER_SIMD)
+
+// Scan characters [begin, end) one at a time, `previous_slash` telling if the one before is a '/'.
+static void
+scan_characters(
+  const char * name,
+  size_t begin,
+  size_t end,
+  bool previous_slash,
+  bool allow_forward_slash,
+  rmw_name_scan_t * scan)
+{
+  const uint8_t allowed = allow_forward_slash ? (CHAR_WORD | CHAR_SLASH) : CHAR_WORD;
+  for (size_t i = begin; i < end; ++i) {
+    const uint8_t char_class = g_char_classes[(uint8_t)name[i]];
+    if (0u == (char_class & allowed)) {
+      scan->first_unallowed = i;
+      return;
+    }
+    if (previous_slash && 0u != (char_class & (CHAR_SLASH | CHAR_DIGIT)) &&
+      scan->first_bad_token_start == end)
+    {
+      scan->first_bad_token_start = i;
+    }
+    previous_slash = 0u != (char_class & CHAR_SLASH);
+  }
+}
+
+void
+rmw_scan_name(
+  const char * name,
+  size_t name_length,
+  bool allow_forward_slash,
+  rmw_name_scan_t * scan)
+{
+  scan->first_unallowed = name_length;
+  scan->first_bad_token_start = name_length;
+  size_t offset = 0u;
+#if defined(NAME_SCANNER_SIMD)
+  // Whether the last character of the previous block is a '/'.
+  uint64_t carry = 0u;
+  for (; offset < name_length; offset += BLOCK_SIZE) {
+    const uint8_t * block = (const uint8_t *)name + offset;
+    uint8_t padded_block[BLOCK_SIZE];
+    if (name_length - offset < BLOCK_SIZE) {
+      if (name_length - offset < SHORT_TAIL_SIZE) {
+        // Padding costs more than looking at a few characters on their own.
+        break;
+      }
+      // Pad the last block with a character that is allowed but never part of a bad token,
+      // rather than reading past the end of the name.
+      memset(padded_block, 'a', BLOCK_SIZE);
+      memcpy(padded_block, block, name_length - offset);
+      block = padded_block;
+    }
+    block_masks_t masks;
+    classify_block(block, allow_forward_slash, &masks);
+    if (0u != masks.unallowed) {
+      scan->first_unallowed = offset + count_trailing_zeros(masks.unallowed);
+      return;
+    }
+    if (scan->first_bad_token_start == name_length) {
+      const uint64_t bad_token_starts =
+        ((masks.slash << 1u) | carry) & (masks.slash | masks.digit);
+      if (0u != bad_token_starts) {
+        scan->first_bad_token_start = offset + count_trailing_zeros(bad_token_starts);
+      }
+    }
+    carry = masks.slash >> (BLOCK_SIZE - 1u);
+  }
+  if (offset >= name_length) {
+    return;
+  }
+#endif
+  scan_characters(
+    name, offset, name_length, offset > 0u && '/' == name[offset - 1u], allow_forward_slash,
+    scan);
+}
+
+int
+rmw_check_absolute_name(
+  const char * name,
+  size_t name_length,
+  size_t * invalid_index)
+{
+  size_t index;
+  int result;
+  if (name_length == 0) {
+    result = RMW_TOPIC_INVALID_IS_EMPTY_STRING;
+    index = 0;
+  } else if (name[0] != '/') {
+    result = RMW_TOPIC_INVALID_NOT_ABSOLUTE;
+    index = 0;
+  } else if (name[name_length - 1] == '/') {
+    // catches both "/foo/" and "/"
+    result = RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH;
+    index = name_length - 1;
+  } else {
+    // check for unallowed characters, then for double '/' and tokens that start with a number
+    rmw_name_scan_t scan;
+    rmw_scan_name(name, name_length, true, &scan);
+    if (scan.first_unallowed < name_length) {
+      // it is none of alphanumerics, '_' or '/', so it is an unallowed character
+      result = RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
+      index = scan.first_unallowed;
+    } else if (scan.first_bad_token_start < name_length) {
+      // either a '/' or a number, i.e. [0-9], follows a '/'
+      result = name[scan.first_bad_token_start] == '/' ?
+        RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH :
+        RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
+      index = scan.first_bad_token_start;
+    } else {
+      return RMW_TOPIC_VALID;
+    }
+  }
+  if (invalid_index) {
+    *invalid_index = index;
+  }
+  return result;
+}
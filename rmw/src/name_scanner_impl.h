@@ -0,0 +1,66 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAME_SCANNER_IMPL_H_
+#define NAME_SCANNER_IMPL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Findings of a single pass over a name, indices are the name length if nothing was found.
+typedef struct rmw_name_scan_s
+{
+  /// Index of the first character other than alphanumerics, '_', and '/' if allowed.
+  size_t first_unallowed;
+  /// Index of the first character following a '/' that is a '/' or a digit.
+  /**
+   * Only meaningful if `first_unallowed` is the name length, as scanning stops at the
+   * first unallowed character.
+   */
+  size_t first_bad_token_start;
+} rmw_name_scan_t;
+
+/// Scan a name in a single pass, many characters at a time where SIMD is available.
+RMW_LOCAL
+void
+rmw_scan_name(
+  const char * name,
+  size_t name_length,
+  bool allow_forward_slash,
+  rmw_name_scan_t * scan);
+
+/// Check the rules that topic names and namespaces share, all but their length limit.
+/**
+ * \return one of the `RMW_TOPIC_*` validation results other than `RMW_TOPIC_INVALID_TOO_LONG`,
+ *   with the index of the error stored in `invalid_index` if it is not NULL and the name invalid.
+ */
+RMW_LOCAL
+int
+rmw_check_absolute_name(
+  const char * name,
+  size_t name_length,
+  size_t * invalid_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NAME_SCANNER_IMPL_H_
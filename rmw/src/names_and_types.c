@@ -14,6 +14,10 @@
 
 #include "rmw/names_and_types.h"
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
 #include "rcutils/types/string_array.h"
@@ -21,6 +25,94 @@
 #include "rmw/convert_rcutils_ret_to_rmw_ret.h"
 #include "rmw/types.h"
 
+// Alignment of every allocation drawn from an arena.
+#define ARENA_ALIGNMENT sizeof(void *)
+
+// Header of the single memory block of an arena-backed array of names and types.
+typedef struct names_and_types_arena_s
+{
+  // Allocator of the memory block.
+  rcutils_allocator_t allocator;
+  // Start of the free part of the arena.
+  char * next;
+  // End of the arena.
+  char * end;
+  // Last allocation, the only one that can be reclaimed or resized, or NULL.
+  char * last;
+} names_and_types_arena_t;
+
+static size_t
+align_size(size_t size)
+{
+  return (size + ARENA_ALIGNMENT - 1u) & ~(ARENA_ALIGNMENT - 1u);
+}
+
+static void *
+arena_allocate(size_t size, void * state)
+{
+  names_and_types_arena_t * arena = (names_and_types_arena_t *)state;
+  if (size > (size_t)(arena->end - arena->next)) {
+    return NULL;
+  }
+  // The arena end is aligned, so this cannot overflow past it.
+  const size_t aligned_size = align_size(size);
+  arena->last = arena->next;
+  arena->next += aligned_size;
+  return arena->last;
+}
+
+static void
+arena_deallocate(void * pointer, void * state)
+{
+  names_and_types_arena_t * arena = (names_and_types_arena_t *)state;
+  if (NULL != pointer && pointer == arena->last) {
+    arena->next = arena->last;
+    arena->last = NULL;
+  }
+}
+
+static void *
+arena_reallocate(void * pointer, size_t size, void * state)
+{
+  names_and_types_arena_t * arena = (names_and_types_arena_t *)state;
+  if (NULL == pointer) {
+    return arena_allocate(size, state);
+  }
+  if (pointer != arena->last || size > (size_t)(arena->end - arena->last)) {
+    return NULL;
+  }
+  arena->next = arena->last + align_size(size);
+  return pointer;
+}
+
+static void *
+arena_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  if (0u != size_of_element && number_of_elements > SIZE_MAX / size_of_element) {
+    return NULL;
+  }
+  const size_t size = number_of_elements * size_of_element;
+  void * pointer = arena_allocate(size, state);
+  if (NULL != pointer) {
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+// Add `count` times `size` to `total`, returning false on overflow.
+static bool
+add_sizes(size_t * total, size_t count, size_t size)
+{
+  if (0u != size && count > SIZE_MAX / size) {
+    return false;
+  }
+  if (count * size > SIZE_MAX - *total) {
+    return false;
+  }
+  *total += count * size;
+  return true;
+}
+
 rmw_names_and_types_t
 rmw_get_zero_initialized_names_and_types(void)
 {
@@ -84,6 +176,82 @@ rmw_names_and_types_init(
   return RMW_RET_OK;
 }
 
+rmw_ret_t
+rmw_names_and_types_init_with_arena(
+  rmw_names_and_types_t * names_and_types,
+  size_t size,
+  size_t arena_size,
+  rcutils_allocator_t * allocator)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_BAD_ALLOC);
+
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret = rmw_names_and_types_check_zero(names_and_types);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  // The block holds the arena header, the names, the types and then the arena itself.
+  const size_t header_size = align_size(sizeof(names_and_types_arena_t));
+  const size_t names_size = align_size(size * sizeof(char *));
+  size_t block_size = header_size;
+  if (
+    size > SIZE_MAX / sizeof(char *) ||
+    align_size(arena_size) < arena_size ||
+    !add_sizes(&block_size, 1u, names_size) ||
+    !add_sizes(&block_size, size, sizeof(rcutils_string_array_t)) ||
+    !add_sizes(&block_size, 1u, align_size(arena_size)))
+  {
+    RMW_SET_ERROR_MSG("names and types memory block is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  char * block = allocator->zero_allocate(1u, block_size, allocator->state);
+  if (!block) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for names and types");
+    return RMW_RET_BAD_ALLOC;
+  }
+  names_and_types_arena_t * arena = (names_and_types_arena_t *)block;
+  arena->allocator = *allocator;
+  arena->next = block + header_size + names_size + size * sizeof(rcutils_string_array_t);
+  arena->end = block + block_size;
+  arena->last = NULL;
+
+  names_and_types->names.size = size;
+  names_and_types->names.data = size != 0u ? (char **)(block + header_size) : NULL;
+  names_and_types->names.allocator.allocate = arena_allocate;
+  names_and_types->names.allocator.deallocate = arena_deallocate;
+  names_and_types->names.allocator.reallocate = arena_reallocate;
+  names_and_types->names.allocator.zero_allocate = arena_zero_allocate;
+  names_and_types->names.allocator.state = arena;
+  names_and_types->types =
+    size != 0u ? (rcutils_string_array_t *)(block + header_size + names_size) : NULL;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_names_and_types_get_arena_size(
+  size_t size,
+  size_t types_count,
+  size_t strings_length,
+  size_t * arena_size)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(arena_size, RMW_RET_INVALID_ARGUMENT);
+  // Type name arrays are a multiple of the alignment, strings need up to one alignment
+  // worth of padding, null terminator included.
+  size_t total = strings_length;
+  if (
+    !add_sizes(&total, types_count, sizeof(char *)) ||
+    !add_sizes(&total, size, ARENA_ALIGNMENT) ||
+    !add_sizes(&total, types_count, ARENA_ALIGNMENT))
+  {
+    RMW_SET_ERROR_MSG("names and types arena size overflows");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *arena_size = total;
+  return RMW_RET_OK;
+}
+
 rmw_ret_t
 rmw_names_and_types_fini(rmw_names_and_types_t * names_and_types)
 {
@@ -91,6 +259,13 @@ rmw_names_and_types_fini(rmw_names_and_types_t * names_and_types)
     RMW_SET_ERROR_MSG("names_and_types is null");
     return RMW_RET_INVALID_ARGUMENT;
   }
+  if (names_and_types->names.allocator.deallocate == arena_deallocate) {
+    // Everything lives in the arena memory block
+    names_and_types_arena_t * arena = names_and_types->names.allocator.state;
+    arena->allocator.deallocate(arena, arena->allocator.state);
+    *names_and_types = rmw_get_zero_initialized_names_and_types();
+    return RMW_RET_OK;
+  }
   rcutils_ret_t rcutils_ret;
   if (names_and_types->types) {
     RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
@@ -0,0 +1,214 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/serialized_message_iov.h"
+
+#include <string.h>
+
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/error_handling.h"
+
+rmw_serialized_message_iov_t
+rmw_get_zero_initialized_serialized_message_iov(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_serialized_message_iov_t serialized_message_iov;
+  return serialized_message_iov;
+}
+
+// Move the segments to a new array of the given capacity.
+static rmw_ret_t
+resize(rmw_serialized_message_iov_t * iov, size_t segment_capacity)
+{
+  rcutils_allocator_t * allocator = iov->allocator;
+  if (segment_capacity > SIZE_MAX / sizeof(rmw_serialized_message_segment_t)) {
+    RMW_SET_ERROR_MSG("serialized message segment count overflows");
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_serialized_message_segment_t * segments = allocator->allocate(
+    segment_capacity * sizeof(rmw_serialized_message_segment_t), allocator->state);
+  if (NULL == segments) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for serialized message segments");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (NULL != iov->segments) {
+    if (iov->segment_count > 0u) {
+      memcpy(
+        segments, iov->segments, iov->segment_count * sizeof(rmw_serialized_message_segment_t));
+    }
+    allocator->deallocate(iov->segments, allocator->state);
+  }
+  iov->segments = segments;
+  iov->segment_capacity = segment_capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_iov_init(
+  rmw_serialized_message_iov_t * iov,
+  size_t segment_capacity,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(iov, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  rmw_serialized_message_iov_t tmp = rmw_get_zero_initialized_serialized_message_iov();
+  tmp.allocator = allocator;
+  if (segment_capacity > 0u) {
+    rmw_ret_t ret = resize(&tmp, segment_capacity);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  *iov = tmp;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_iov_fini(rmw_serialized_message_iov_t * iov)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(iov, RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != iov->segments) {
+    RCUTILS_CHECK_ALLOCATOR(iov->allocator, return RMW_RET_INVALID_ARGUMENT);
+    iov->allocator->deallocate(iov->segments, iov->allocator->state);
+  }
+
+  *iov = rmw_get_zero_initialized_serialized_message_iov();
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_iov_append(
+  rmw_serialized_message_iov_t * iov,
+  uint8_t * data,
+  size_t length)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(iov, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == data && length > 0u) {
+    RMW_SET_ERROR_MSG("data is null but length is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  if (iov->segment_count == iov->segment_capacity) {
+    RCUTILS_CHECK_ALLOCATOR(iov->allocator, return RMW_RET_INVALID_ARGUMENT);
+    if (iov->segment_capacity > SIZE_MAX / 2u) {
+      RMW_SET_ERROR_MSG("serialized message segment count overflows");
+      return RMW_RET_BAD_ALLOC;
+    }
+    // Header plus payload is the common case, start with room for both.
+    const size_t segment_capacity = iov->segment_capacity > 0u ? iov->segment_capacity * 2u : 2u;
+    rmw_ret_t ret = resize(iov, segment_capacity);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  iov->segments[iov->segment_count].data = data;
+  iov->segments[iov->segment_count].length = length;
+  ++iov->segment_count;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_iov_get_length(
+  const rmw_serialized_message_iov_t * iov,
+  size_t * length)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(iov, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(length, RMW_RET_INVALID_ARGUMENT);
+
+  size_t total = 0u;
+  for (size_t i = 0u; i < iov->segment_count; ++i) {
+    if (iov->segments[i].length > SIZE_MAX - total) {
+      RMW_SET_ERROR_MSG("serialized message length overflows");
+      return RMW_RET_ERROR;
+    }
+    total += iov->segments[i].length;
+  }
+  *length = total;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_iov_gather(
+  const rmw_serialized_message_iov_t * iov,
+  rmw_serialized_message_t * serialized_message)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(iov, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+
+  size_t length = 0u;
+  rmw_ret_t ret = rmw_serialized_message_iov_get_length(iov, &length);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  if (length > serialized_message->buffer_capacity) {
+    ret = rmw_convert_rcutils_ret_to_rmw_ret(
+      rmw_serialized_message_resize(serialized_message, length));
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  size_t offset = 0u;
+  for (size_t i = 0u; i < iov->segment_count; ++i) {
+    if (iov->segments[i].length > 0u) {
+      memcpy(
+        serialized_message->buffer + offset, iov->segments[i].data, iov->segments[i].length);
+      offset += iov->segments[i].length;
+    }
+  }
+  serialized_message->buffer_length = length;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_iov_scatter(
+  const uint8_t * data,
+  size_t length,
+  rmw_serialized_message_iov_t * iov)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(iov, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == data && length > 0u) {
+    RMW_SET_ERROR_MSG("data is null but length is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  size_t capacity = 0u;
+  if (RMW_RET_OK != rmw_serialized_message_iov_get_length(iov, &capacity)) {
+    // Segments holding more than SIZE_MAX bytes can hold any length.
+    rmw_reset_error();
+    capacity = SIZE_MAX;
+  }
+  if (length > capacity) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "segments hold %zu bytes, cannot scatter %zu bytes", capacity, length);
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  size_t offset = 0u;
+  for (size_t i = 0u; i < iov->segment_count && offset < length; ++i) {
+    const size_t remaining = length - offset;
+    const size_t chunk = iov->segments[i].length < remaining ? iov->segments[i].length : remaining;
+    if (chunk > 0u) {
+      memcpy(iov->segments[i].data, data + offset, chunk);
+      offset += chunk;
+    }
+  }
+
+  return RMW_RET_OK;
+}
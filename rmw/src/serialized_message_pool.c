@@ -0,0 +1,629 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/serialized_message_pool.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "rcutils/macros.h"
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+
+#include "./spin_lock_impl.h"
+
+// Number of pools each thread keeps a cache for at once.
+#define THREAD_CACHE_SLOTS 4u
+
+// Size class of the blocks that bypass the pool.
+#define LARGE_SIZE_CLASS SIZE_MAX
+
+// Header in front of every block, keeping the block suitably aligned for any type.
+typedef union block_header_u
+{
+  struct
+  {
+    size_t size_class;
+    // Requested size, only meaningful for large blocks.
+    size_t size;
+  } info;
+  max_align_t align;
+} block_header_t;
+
+// Free blocks are linked through their first word.
+typedef struct free_block_s
+{
+  struct free_block_s * next;
+} free_block_t;
+
+typedef struct free_list_s
+{
+  free_block_t * head;
+  size_t count;
+} free_list_t;
+
+typedef struct thread_cache_s
+{
+  // Next cache registered with the same pool.
+  struct thread_cache_s * next;
+  // Whether no thread uses this cache anymore, so that another one may adopt it.
+  bool orphaned;
+  free_list_t lists[RMW_SERIALIZED_MESSAGE_POOL_MAX_SIZE_CLASSES];
+} thread_cache_t;
+
+struct rmw_serialized_message_pool_impl_s
+{
+  // Unique over the process lifetime, so that stale thread cache slots never match.
+  uint64_t id;
+  // Guards the depot and the cache registry.
+  atomic_bool lock;
+  rmw_serialized_message_pool_options_t options;
+  size_t size_class_count;
+  free_list_t depot[RMW_SERIALIZED_MESSAGE_POOL_MAX_SIZE_CLASSES];
+  // Every thread cache created for this pool, in use or orphaned.
+  thread_cache_t * caches;
+  // Next live pool, guarded by the registry lock.
+  rmw_serialized_message_pool_impl_t * next_live;
+  // Number of threads giving blocks of an evicted cache back to the backing allocator,
+  // guarded by the registry lock. The pool is not finalized until it drops to zero.
+  size_t releasing_count;
+  rcutils_allocator_t allocator;
+};
+
+typedef struct thread_cache_slot_s
+{
+  uint64_t pool_id;
+  thread_cache_t * cache;
+} thread_cache_slot_t;
+
+static RCUTILS_THREAD_LOCAL thread_cache_slot_t t_slots[THREAD_CACHE_SLOTS];
+static RCUTILS_THREAD_LOCAL size_t t_next_slot;
+// Whether the calling thread releases its slots when it exits.
+static RCUTILS_THREAD_LOCAL bool t_exit_hook_set;
+
+// Registry of live pools, so that threads can tell whether the pool behind a cache they
+// evict is still around. Always taken before a pool lock.
+static atomic_bool g_registry_lock;
+static rmw_serialized_message_pool_impl_t * g_live_pools;
+static uint64_t g_next_pool_id = 1u;
+
+static bool
+is_power_of_two(size_t value)
+{
+  return 0u != value && 0u == (value & (value - 1u));
+}
+
+static size_t
+size_class_of(const rmw_serialized_message_pool_impl_t * impl, size_t size)
+{
+  if (size > impl->options.max_block_size) {
+    return LARGE_SIZE_CLASS;
+  }
+  size_t size_class = 0u;
+  size_t block_size = impl->options.min_block_size;
+  while (block_size < size) {
+    block_size <<= 1u;
+    ++size_class;
+  }
+  return size_class;
+}
+
+static size_t
+block_size_of(const rmw_serialized_message_pool_impl_t * impl, size_t size_class)
+{
+  return impl->options.min_block_size << size_class;
+}
+
+static block_header_t *
+header_of(void * pointer)
+{
+  return (block_header_t *)pointer - 1;
+}
+
+static void
+push(free_list_t * list, void * pointer)
+{
+  free_block_t * block = pointer;
+  block->next = list->head;
+  list->head = block;
+  ++list->count;
+}
+
+static void *
+pop(free_list_t * list)
+{
+  free_block_t * block = list->head;
+  if (NULL != block) {
+    list->head = block->next;
+    --list->count;
+  }
+  return block;
+}
+
+static void
+deallocate_block(rmw_serialized_message_pool_impl_t * impl, void * pointer)
+{
+  impl->allocator.deallocate(header_of(pointer), impl->allocator.state);
+}
+
+static void
+deallocate_list(rmw_serialized_message_pool_impl_t * impl, free_block_t * head)
+{
+  while (NULL != head) {
+    free_block_t * next = head->next;
+    deallocate_block(impl, head);
+    head = next;
+  }
+}
+
+// Move up to `count` blocks from one list to another.
+static void
+transfer(free_list_t * from, free_list_t * to, size_t count)
+{
+  for (size_t i = 0u; i < count && NULL != from->head; ++i) {
+    push(to, pop(from));
+  }
+}
+
+// Move all blocks of a cache to the depot, returning the overflow to be deallocated.
+// Must be called with the pool locked.
+static free_block_t *
+flush_to_depot(rmw_serialized_message_pool_impl_t * impl, thread_cache_t * cache)
+{
+  free_list_t overflow = {NULL, 0u};
+  for (size_t i = 0u; i < impl->size_class_count; ++i) {
+    const size_t room = impl->options.depot_capacity - impl->depot[i].count;
+    transfer(&cache->lists[i], &impl->depot[i], room);
+    transfer(&cache->lists[i], &overflow, SIZE_MAX);
+  }
+  return overflow.head;
+}
+
+// Give up the cache held in a slot, handing it over to its pool if still alive.
+static void
+release_slot(thread_cache_slot_t * slot)
+{
+  free_block_t * overflow = NULL;
+  rmw_serialized_message_pool_impl_t * impl = NULL;
+  rmw_spin_lock(&g_registry_lock);
+  for (impl = g_live_pools; NULL != impl; impl = impl->next_live) {
+    if (impl->id == slot->pool_id) {
+      rmw_spin_lock(&impl->lock);
+      overflow = flush_to_depot(impl, slot->cache);
+      slot->cache->orphaned = true;
+      rmw_spin_unlock(&impl->lock);
+      if (NULL != overflow) {
+        // Keeps the pool alive until the overflow is deallocated.
+        ++impl->releasing_count;
+      }
+      break;
+    }
+  }
+  rmw_spin_unlock(&g_registry_lock);
+  slot->pool_id = 0u;
+  slot->cache = NULL;
+  if (NULL != overflow) {
+    // Deallocate without holding any lock, the backing allocator may take a while.
+    deallocate_list(impl, overflow);
+    rmw_spin_lock(&g_registry_lock);
+    --impl->releasing_count;
+    rmw_spin_unlock(&g_registry_lock);
+  }
+}
+
+// Release all slots of a thread, when it exits.
+static void
+release_thread_slots(void * slots)
+{
+  thread_cache_slot_t * thread_slots = slots;
+  for (size_t i = 0u; i < THREAD_CACHE_SLOTS; ++i) {
+    if (0u != thread_slots[i].pool_id) {
+      release_slot(&thread_slots[i]);
+    }
+  }
+  // The hook is consumed, set it again if pools are used by later thread exit hooks.
+  t_exit_hook_set = false;
+}
+
+#ifdef _WIN32
+static INIT_ONCE g_thread_exit_once = INIT_ONCE_STATIC_INIT;
+static DWORD g_thread_exit_key = FLS_OUT_OF_INDEXES;
+
+static VOID WINAPI
+on_thread_exit(PVOID slots)
+{
+  release_thread_slots(slots);
+}
+
+static BOOL CALLBACK
+create_thread_exit_key(PINIT_ONCE once, PVOID parameter, PVOID * context)
+{
+  (void)once;
+  (void)parameter;
+  (void)context;
+  g_thread_exit_key = FlsAlloc(on_thread_exit);
+  return TRUE;
+}
+#else
+static pthread_once_t g_thread_exit_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_thread_exit_key;
+static bool g_thread_exit_key_created = false;
+
+static void
+create_thread_exit_key(void)
+{
+  g_thread_exit_key_created =
+    0 == pthread_key_create(&g_thread_exit_key, release_thread_slots);
+}
+#endif
+
+// Have the slots of the calling thread released when it exits, so that the caches of
+// exited threads are adopted by new ones.
+static bool
+set_thread_exit_hook(void)
+{
+  if (t_exit_hook_set) {
+    return true;
+  }
+#ifdef _WIN32
+  (void)InitOnceExecuteOnce(&g_thread_exit_once, create_thread_exit_key, NULL, NULL);
+  t_exit_hook_set =
+    FLS_OUT_OF_INDEXES != g_thread_exit_key && FlsSetValue(g_thread_exit_key, t_slots);
+#else
+  (void)pthread_once(&g_thread_exit_once, create_thread_exit_key);
+  t_exit_hook_set =
+    g_thread_exit_key_created && 0 == pthread_setspecific(g_thread_exit_key, t_slots);
+#endif
+  return t_exit_hook_set;
+}
+
+// Adopt an orphaned cache of the pool, or create one.
+static thread_cache_t *
+acquire_cache(rmw_serialized_message_pool_impl_t * impl)
+{
+  rmw_spin_lock(&impl->lock);
+  for (thread_cache_t * cache = impl->caches; NULL != cache; cache = cache->next) {
+    if (cache->orphaned) {
+      cache->orphaned = false;
+      rmw_spin_unlock(&impl->lock);
+      return cache;
+    }
+  }
+  rmw_spin_unlock(&impl->lock);
+
+  thread_cache_t * cache = impl->allocator.zero_allocate(
+    1u, sizeof(thread_cache_t), impl->allocator.state);
+  if (NULL == cache) {
+    // Not fatal, the depot is used directly instead.
+    return NULL;
+  }
+  rmw_spin_lock(&impl->lock);
+  cache->next = impl->caches;
+  impl->caches = cache;
+  rmw_spin_unlock(&impl->lock);
+  return cache;
+}
+
+// Get the cache of the calling thread for the pool, NULL if caches are disabled or
+// if one could not be allocated.
+static thread_cache_t *
+get_thread_cache(rmw_serialized_message_pool_impl_t * impl)
+{
+  if (0u == impl->options.thread_cache_capacity) {
+    return NULL;
+  }
+  for (size_t i = 0u; i < THREAD_CACHE_SLOTS; ++i) {
+    if (t_slots[i].pool_id == impl->id) {
+      return t_slots[i].cache;
+    }
+  }
+  if (!set_thread_exit_hook()) {
+    // A cache that is never released would leak, use the depot directly instead.
+    return NULL;
+  }
+  thread_cache_slot_t * slot = &t_slots[t_next_slot];
+  t_next_slot = (t_next_slot + 1u) % THREAD_CACHE_SLOTS;
+  if (0u != slot->pool_id) {
+    release_slot(slot);
+  }
+  thread_cache_t * cache = acquire_cache(impl);
+  if (NULL != cache) {
+    slot->pool_id = impl->id;
+    slot->cache = cache;
+  }
+  return cache;
+}
+
+static void *
+allocate_new_block(rmw_serialized_message_pool_impl_t * impl, size_t size_class, size_t size)
+{
+  const size_t block_size =
+    LARGE_SIZE_CLASS == size_class ? size : block_size_of(impl, size_class);
+  if (block_size > SIZE_MAX - sizeof(block_header_t)) {
+    return NULL;
+  }
+  block_header_t * header = impl->allocator.allocate(
+    sizeof(block_header_t) + block_size, impl->allocator.state);
+  if (NULL == header) {
+    return NULL;
+  }
+  header->info.size_class = size_class;
+  header->info.size = size;
+  return header + 1;
+}
+
+static void *
+pool_allocate(size_t size, void * state)
+{
+  rmw_serialized_message_pool_impl_t * impl = state;
+  const size_t size_class = size_class_of(impl, size);
+  if (LARGE_SIZE_CLASS == size_class) {
+    return allocate_new_block(impl, size_class, size);
+  }
+
+  thread_cache_t * cache = get_thread_cache(impl);
+  void * pointer = NULL;
+  if (NULL != cache) {
+    pointer = pop(&cache->lists[size_class]);
+    if (NULL != pointer) {
+      return pointer;
+    }
+  }
+  rmw_spin_lock(&impl->lock);
+  pointer = pop(&impl->depot[size_class]);
+  if (NULL != pointer && NULL != cache) {
+    // Refill half of the cache while at it, to amortize the lock.
+    transfer(
+      &impl->depot[size_class], &cache->lists[size_class],
+      impl->options.thread_cache_capacity / 2u);
+  }
+  rmw_spin_unlock(&impl->lock);
+  if (NULL != pointer) {
+    return pointer;
+  }
+  return allocate_new_block(impl, size_class, size);
+}
+
+static void
+pool_deallocate(void * pointer, void * state)
+{
+  if (NULL == pointer) {
+    return;
+  }
+  rmw_serialized_message_pool_impl_t * impl = state;
+  const size_t size_class = header_of(pointer)->info.size_class;
+  if (LARGE_SIZE_CLASS == size_class) {
+    deallocate_block(impl, pointer);
+    return;
+  }
+
+  thread_cache_t * cache = get_thread_cache(impl);
+  if (NULL != cache) {
+    free_list_t * list = &cache->lists[size_class];
+    push(list, pointer);
+    if (list->count <= impl->options.thread_cache_capacity) {
+      return;
+    }
+  }
+  // Spill half of the cache, or the block itself without a cache, to the depot.
+  free_list_t overflow = {NULL, 0u};
+  rmw_spin_lock(&impl->lock);
+  free_list_t * depot = &impl->depot[size_class];
+  if (NULL != cache) {
+    const size_t spill = (impl->options.thread_cache_capacity + 1u) / 2u;
+    const size_t room = impl->options.depot_capacity - depot->count;
+    transfer(&cache->lists[size_class], depot, spill < room ? spill : room);
+    transfer(&cache->lists[size_class], &overflow, spill < room ? 0u : spill - room);
+  } else if (depot->count < impl->options.depot_capacity) {
+    push(depot, pointer);
+  } else {
+    push(&overflow, pointer);
+  }
+  rmw_spin_unlock(&impl->lock);
+  deallocate_list(impl, overflow.head);
+}
+
+static size_t
+usable_size(const rmw_serialized_message_pool_impl_t * impl, void * pointer)
+{
+  const block_header_t * header = header_of(pointer);
+  return LARGE_SIZE_CLASS == header->info.size_class ?
+         header->info.size : block_size_of(impl, header->info.size_class);
+}
+
+static void *
+pool_reallocate(void * pointer, size_t size, void * state)
+{
+  if (NULL == pointer) {
+    return pool_allocate(size, state);
+  }
+  rmw_serialized_message_pool_impl_t * impl = state;
+  const size_t old_size = usable_size(impl, pointer);
+  if (LARGE_SIZE_CLASS != header_of(pointer)->info.size_class && size <= old_size) {
+    // Still fits in its size class.
+    return pointer;
+  }
+  void * new_pointer = pool_allocate(size, state);
+  if (NULL == new_pointer) {
+    return NULL;
+  }
+  memcpy(new_pointer, pointer, old_size < size ? old_size : size);
+  pool_deallocate(pointer, state);
+  return new_pointer;
+}
+
+static void *
+pool_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  if (0u != size_of_element && number_of_elements > SIZE_MAX / size_of_element) {
+    return NULL;
+  }
+  const size_t size = number_of_elements * size_of_element;
+  void * pointer = pool_allocate(size, state);
+  if (NULL != pointer) {
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+rmw_serialized_message_pool_t
+rmw_get_zero_initialized_serialized_message_pool(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_serialized_message_pool_t serialized_message_pool;
+  return serialized_message_pool;
+}
+
+rmw_serialized_message_pool_options_t
+rmw_get_default_serialized_message_pool_options(void)
+{
+  rmw_serialized_message_pool_options_t options = {
+    .min_block_size = 64u,
+    .max_block_size = 1024u * 1024u,
+    .thread_cache_capacity = 8u,
+    .depot_capacity = 64u,
+  };
+  return options;
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_init(
+  rmw_serialized_message_pool_t * pool,
+  const rmw_serialized_message_pool_options_t * options,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(options, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+  if (!is_power_of_two(options->min_block_size) || !is_power_of_two(options->max_block_size)) {
+    RMW_SET_ERROR_MSG("block sizes must be powers of two");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (options->min_block_size < sizeof(free_block_t)) {
+    RMW_SET_ERROR_MSG("min_block_size must be able to hold a pointer");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (options->max_block_size < options->min_block_size) {
+    RMW_SET_ERROR_MSG("max_block_size must not be smaller than min_block_size");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  size_t size_class_count = 1u;
+  for (size_t block_size = options->min_block_size; block_size < options->max_block_size;
+    block_size <<= 1u)
+  {
+    ++size_class_count;
+  }
+  if (size_class_count > RMW_SERIALIZED_MESSAGE_POOL_MAX_SIZE_CLASSES) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "%zu size classes requested, at most %u are supported",
+      size_class_count, RMW_SERIALIZED_MESSAGE_POOL_MAX_SIZE_CLASSES);
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  rmw_serialized_message_pool_impl_t * impl = allocator->zero_allocate(
+    1u, sizeof(rmw_serialized_message_pool_impl_t), allocator->state);
+  if (NULL == impl) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for serialized message pool");
+    return RMW_RET_BAD_ALLOC;
+  }
+  atomic_init(&impl->lock, false);
+  impl->options = *options;
+  impl->size_class_count = size_class_count;
+  impl->allocator = *allocator;
+
+  rmw_spin_lock(&g_registry_lock);
+  impl->id = g_next_pool_id++;
+  impl->next_live = g_live_pools;
+  g_live_pools = impl;
+  rmw_spin_unlock(&g_registry_lock);
+
+  pool->impl = impl;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_fini(rmw_serialized_message_pool_t * pool)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  rmw_serialized_message_pool_impl_t * impl = pool->impl;
+  if (NULL == impl) {
+    return RMW_RET_OK;
+  }
+
+  // Once unregistered, threads evicting a cache of this pool leave it alone.
+  rmw_spin_lock(&g_registry_lock);
+  rmw_serialized_message_pool_impl_t ** link = &g_live_pools;
+  while (*link != impl) {
+    link = &(*link)->next_live;
+  }
+  *link = impl->next_live;
+  rmw_spin_unlock(&g_registry_lock);
+  // Wait for threads still deallocating blocks of a cache they evicted.
+  bool releasing = true;
+  while (releasing) {
+    rmw_spin_lock(&g_registry_lock);
+    releasing = 0u != impl->releasing_count;
+    rmw_spin_unlock(&g_registry_lock);
+  }
+
+  for (size_t i = 0u; i < impl->size_class_count; ++i) {
+    deallocate_list(impl, impl->depot[i].head);
+  }
+  thread_cache_t * cache = impl->caches;
+  while (NULL != cache) {
+    thread_cache_t * next = cache->next;
+    for (size_t i = 0u; i < impl->size_class_count; ++i) {
+      deallocate_list(impl, cache->lists[i].head);
+    }
+    impl->allocator.deallocate(cache, impl->allocator.state);
+    cache = next;
+  }
+  for (size_t i = 0u; i < THREAD_CACHE_SLOTS; ++i) {
+    if (t_slots[i].pool_id == impl->id) {
+      t_slots[i].pool_id = 0u;
+      t_slots[i].cache = NULL;
+    }
+  }
+  rcutils_allocator_t allocator = impl->allocator;
+  allocator.deallocate(impl, allocator.state);
+
+  *pool = rmw_get_zero_initialized_serialized_message_pool();
+
+  return RMW_RET_OK;
+}
+
+rcutils_allocator_t
+rmw_serialized_message_pool_get_allocator(const rmw_serialized_message_pool_t * pool)
+{
+  rcutils_allocator_t allocator = rcutils_get_zero_initialized_allocator();
+  if (NULL == pool || NULL == pool->impl) {
+    return allocator;
+  }
+  allocator.allocate = pool_allocate;
+  allocator.deallocate = pool_deallocate;
+  allocator.reallocate = pool_reallocate;
+  allocator.zero_allocate = pool_zero_allocate;
+  allocator.state = pool->impl;
+  return allocator;
+}
@@ -0,0 +1,209 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/serialized_message_sequence.h"
+
+#include <string.h>
+
+#include "rmw/error_handling.h"
+
+rmw_serialized_message_sequence_t
+rmw_get_zero_initialized_serialized_message_sequence(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_serialized_message_sequence_t serialized_message_sequence;
+  return serialized_message_sequence;
+}
+
+static size_t
+bytes_in_use(const rmw_serialized_message_sequence_t * sequence)
+{
+  return NULL != sequence->offsets ? sequence->offsets[sequence->size] : 0u;
+}
+
+// Move the offset table and the buffer to a new allocation of the given capacities,
+// which must be able to hold the current contents.
+static rmw_ret_t
+resize(rmw_serialized_message_sequence_t * sequence, size_t capacity, size_t buffer_capacity)
+{
+  rcutils_allocator_t * allocator = sequence->allocator;
+  // The offset table goes first, as it has the stricter alignment requirement.
+  if (capacity >= SIZE_MAX / sizeof(size_t) ||
+    buffer_capacity > SIZE_MAX - (capacity + 1u) * sizeof(size_t))
+  {
+    RMW_SET_ERROR_MSG("serialized message sequence size overflows");
+    return RMW_RET_BAD_ALLOC;
+  }
+  const size_t offsets_size = (capacity + 1u) * sizeof(size_t);
+  size_t * offsets = allocator->allocate(offsets_size + buffer_capacity, allocator->state);
+  if (NULL == offsets) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for serialized message sequence");
+    return RMW_RET_BAD_ALLOC;
+  }
+  uint8_t * buffer = (uint8_t *)offsets + offsets_size;
+  if (NULL != sequence->offsets) {
+    memcpy(offsets, sequence->offsets, (sequence->size + 1u) * sizeof(size_t));
+    const size_t length = bytes_in_use(sequence);
+    if (length > 0u) {
+      memcpy(buffer, sequence->buffer, length);
+    }
+    allocator->deallocate(sequence->offsets, allocator->state);
+  } else {
+    offsets[0] = 0u;
+  }
+  sequence->offsets = offsets;
+  sequence->buffer = buffer;
+  sequence->buffer_capacity = buffer_capacity;
+  sequence->capacity = capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_sequence_init(
+  rmw_serialized_message_sequence_t * sequence,
+  size_t capacity,
+  size_t buffer_capacity,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  rmw_serialized_message_sequence_t tmp = rmw_get_zero_initialized_serialized_message_sequence();
+  tmp.allocator = allocator;
+  if (capacity > 0u || buffer_capacity > 0u) {
+    rmw_ret_t ret = resize(&tmp, capacity, buffer_capacity);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  *sequence = tmp;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_sequence_fini(rmw_serialized_message_sequence_t * sequence)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != sequence->offsets) {
+    RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
+    sequence->allocator->deallocate(sequence->offsets, sequence->allocator->state);
+  }
+
+  *sequence = rmw_get_zero_initialized_serialized_message_sequence();
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_sequence_reset(rmw_serialized_message_sequence_t * sequence)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+
+  sequence->size = 0u;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_sequence_reserve(
+  rmw_serialized_message_sequence_t * sequence,
+  size_t capacity,
+  size_t buffer_capacity)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  if (capacity <= sequence->capacity && buffer_capacity <= sequence->buffer_capacity &&
+    NULL != sequence->offsets)
+  {
+    return RMW_RET_OK;
+  }
+  return resize(
+    sequence,
+    capacity > sequence->capacity ? capacity : sequence->capacity,
+    buffer_capacity > sequence->buffer_capacity ? buffer_capacity : sequence->buffer_capacity);
+}
+
+// Grow a capacity to at least `required`, doubling it if that is enough.
+static size_t
+grow(size_t current, size_t required)
+{
+  if (required <= current) {
+    return current;
+  }
+  const size_t doubled = current > SIZE_MAX / 2u ? SIZE_MAX : current * 2u;
+  return doubled > required ? doubled : required;
+}
+
+rmw_ret_t
+rmw_serialized_message_sequence_append(
+  rmw_serialized_message_sequence_t * sequence,
+  const uint8_t * data,
+  size_t length)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == data && length > 0u) {
+    RMW_SET_ERROR_MSG("data is null but length is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  const size_t used = bytes_in_use(sequence);
+  if (length > SIZE_MAX - used || SIZE_MAX == sequence->size) {
+    RMW_SET_ERROR_MSG("serialized message sequence size overflows");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (sequence->size == sequence->capacity || used + length > sequence->buffer_capacity ||
+    NULL == sequence->offsets)
+  {
+    RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
+    rmw_ret_t ret = resize(
+      sequence,
+      grow(sequence->capacity, sequence->size + 1u),
+      grow(sequence->buffer_capacity, used + length));
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  if (length > 0u) {
+    memcpy(sequence->buffer + used, data, length);
+  }
+  ++sequence->size;
+  sequence->offsets[sequence->size] = used + length;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_sequence_get(
+  const rmw_serialized_message_sequence_t * sequence,
+  size_t index,
+  const uint8_t ** data,
+  size_t * length)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(data, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(length, RMW_RET_INVALID_ARGUMENT);
+  if (index >= sequence->size) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "index %zu is out of range for a sequence of size %zu", index, sequence->size);
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *data = sequence->buffer + sequence->offsets[index];
+  *length = sequence->offsets[index + 1u] - sequence->offsets[index];
+
+  return RMW_RET_OK;
+}
@@ -0,0 +1,194 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/shared_serialized_message.h"
+
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+
+struct rmw_shared_serialized_message_impl_s
+{
+  atomic_uint_least64_t ref_count;
+  uint8_t * buffer;
+  rmw_shared_serialized_message_deleter_t deleter;
+  void * deleter_state;
+  // Allocates this control block.
+  rcutils_allocator_t allocator;
+  // Deallocates the buffer, when it was taken from a serialized message.
+  rcutils_allocator_t buffer_allocator;
+};
+
+rmw_shared_serialized_message_t
+rmw_get_zero_initialized_shared_serialized_message(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_shared_serialized_message_t shared_serialized_message;
+  return shared_serialized_message;
+}
+
+static void
+deallocate_with_allocator(uint8_t * buffer, size_t buffer_length, void * state)
+{
+  (void)buffer_length;
+  rcutils_allocator_t * allocator = state;
+  allocator->deallocate(buffer, allocator->state);
+}
+
+static rmw_shared_serialized_message_impl_t *
+allocate_control_block(rcutils_allocator_t * allocator)
+{
+  rmw_shared_serialized_message_impl_t * impl =
+    allocator->allocate(sizeof(rmw_shared_serialized_message_impl_t), allocator->state);
+  if (NULL == impl) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for shared serialized message");
+    return NULL;
+  }
+  atomic_init(&impl->ref_count, 1u);
+  impl->allocator = *allocator;
+  return impl;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_init_from(
+  rmw_shared_serialized_message_t * shared,
+  rmw_serialized_message_t * serialized_message,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(shared, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(&serialized_message->allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  rmw_shared_serialized_message_impl_t * impl = allocate_control_block(allocator);
+  if (NULL == impl) {
+    return RMW_RET_BAD_ALLOC;
+  }
+  impl->buffer = serialized_message->buffer;
+  impl->buffer_allocator = serialized_message->allocator;
+  impl->deleter = deallocate_with_allocator;
+  impl->deleter_state = &impl->buffer_allocator;
+
+  shared->buffer = serialized_message->buffer;
+  shared->buffer_length = serialized_message->buffer_length;
+  shared->impl = impl;
+  *serialized_message = rmw_get_zero_initialized_serialized_message();
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_init_with_deleter(
+  rmw_shared_serialized_message_t * shared,
+  uint8_t * buffer,
+  size_t buffer_length,
+  rmw_shared_serialized_message_deleter_t deleter,
+  void * deleter_state,
+  rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(shared, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == buffer && buffer_length > 0u) {
+    RMW_SET_ERROR_MSG("buffer is null but buffer_length is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(deleter, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  rmw_shared_serialized_message_impl_t * impl = allocate_control_block(allocator);
+  if (NULL == impl) {
+    return RMW_RET_BAD_ALLOC;
+  }
+  impl->buffer = buffer;
+  impl->buffer_allocator = rcutils_get_zero_initialized_allocator();
+  impl->deleter = deleter;
+  impl->deleter_state = deleter_state;
+
+  shared->buffer = buffer;
+  shared->buffer_length = buffer_length;
+  shared->impl = impl;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_acquire(
+  const rmw_shared_serialized_message_t * source,
+  rmw_shared_serialized_message_t * destination)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(source, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(destination, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == source->impl) {
+    RMW_SET_ERROR_MSG("source holds no reference");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  // The source reference keeps the count above zero, nothing to order against.
+  atomic_fetch_add_explicit(&source->impl->ref_count, 1u, memory_order_relaxed);
+  *destination = *source;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_fini(rmw_shared_serialized_message_t * shared)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(shared, RMW_RET_INVALID_ARGUMENT);
+
+  rmw_shared_serialized_message_impl_t * impl = shared->impl;
+  const size_t buffer_length = shared->buffer_length;
+  *shared = rmw_get_zero_initialized_shared_serialized_message();
+  if (NULL == impl) {
+    return RMW_RET_OK;
+  }
+  // Release so that this holder's reads happen before the buffer is released,
+  // acquire so that the last holder sees every other holder's reads as done.
+  if (1u == atomic_fetch_sub_explicit(&impl->ref_count, 1u, memory_order_acq_rel)) {
+    impl->deleter(impl->buffer, buffer_length, impl->deleter_state);
+    rcutils_allocator_t allocator = impl->allocator;
+    allocator.deallocate(impl, allocator.state);
+  }
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_get_use_count(
+  const rmw_shared_serialized_message_t * shared,
+  size_t * use_count)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(shared, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(use_count, RMW_RET_INVALID_ARGUMENT);
+
+  *use_count = NULL != shared->impl ?
+    (size_t)atomic_load_explicit(&shared->impl->ref_count, memory_order_relaxed) : 0u;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_get_view(
+  const rmw_shared_serialized_message_t * shared,
+  rmw_serialized_message_t * view)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(shared, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(view, RMW_RET_INVALID_ARGUMENT);
+
+  *view = rmw_get_zero_initialized_serialized_message();
+  // The view is only handed to functions taking a const serialized message.
+  view->buffer = (uint8_t *)shared->buffer;
+  view->buffer_length = shared->buffer_length;
+  view->buffer_capacity = shared->buffer_length;
+
+  return RMW_RET_OK;
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPIN_LOCK_IMPL_H_
+#define SPIN_LOCK_IMPL_H_
+
+#include <stdbool.h>
+
+#include "rcutils/stdatomic_helper.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Acquire a lock guarding a short critical section, spinning until it is free.
+/**
+ * Only suitable for critical sections of a handful of memory accesses, which never
+ * block nor allocate.
+ */
+static inline void
+rmw_spin_lock(atomic_bool * lock)
+{
+  while (rcutils_atomic_exchange_bool(lock, true)) {
+    // Spin, the holder is bound to release it shortly.
+  }
+}
+
+/// Release a lock acquired with rmw_spin_lock().
+static inline void
+rmw_spin_unlock(atomic_bool * lock)
+{
+  rcutils_atomic_store(lock, false);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // SPIN_LOCK_IMPL_H_
@@ -0,0 +1,270 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/string_table.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+
+#include "./spin_lock_impl.h"
+
+// Number of buckets of a new table, always a power of two.
+#define INITIAL_BUCKET_COUNT 64u
+
+// Interned string, linked to the next one of its bucket.
+typedef struct entry_s
+{
+  struct entry_s * next;
+  uint64_t hash;
+  size_t length;
+  char string[];
+} entry_t;
+
+struct rmw_string_table_impl_s
+{
+  rcutils_allocator_t allocator;
+  // Guards all members below.
+  atomic_bool lock;
+  entry_t ** buckets;
+  size_t bucket_count;
+  size_t size;
+};
+
+// 64-bit FNV-1a.
+static uint64_t
+hash_string(const char * string, size_t length)
+{
+  uint64_t hash = UINT64_C(14695981039346656037);
+  for (size_t i = 0u; i < length; ++i) {
+    hash ^= (uint8_t)string[i];
+    hash *= UINT64_C(1099511628211);
+  }
+  return hash;
+}
+
+static entry_t *
+find_entry(
+  const rmw_string_table_impl_t * impl, const char * string, size_t length, uint64_t hash)
+{
+  entry_t * entry = impl->buckets[hash & (impl->bucket_count - 1u)];
+  while (NULL != entry) {
+    if (entry->hash == hash && entry->length == length &&
+      0 == memcmp(entry->string, string, length))
+    {
+      return entry;
+    }
+    entry = entry->next;
+  }
+  return NULL;
+}
+
+// Move all entries to `buckets`, which has room for twice as many buckets as the table.
+static void
+rehash(rmw_string_table_impl_t * impl, entry_t ** buckets)
+{
+  const size_t bucket_count = impl->bucket_count * 2u;
+  for (size_t i = 0u; i < impl->bucket_count; ++i) {
+    entry_t * entry = impl->buckets[i];
+    while (NULL != entry) {
+      entry_t * next = entry->next;
+      entry_t ** bucket = &buckets[entry->hash & (bucket_count - 1u)];
+      entry->next = *bucket;
+      *bucket = entry;
+      entry = next;
+    }
+  }
+  impl->allocator.deallocate(impl->buckets, impl->allocator.state);
+  impl->buckets = buckets;
+  impl->bucket_count = bucket_count;
+}
+
+// Grow the table if it is over three quarters full, allocating outside of the lock.
+static void
+maybe_grow(rmw_string_table_impl_t * impl)
+{
+  rmw_spin_lock(&impl->lock);
+  const size_t bucket_count = impl->bucket_count;
+  const bool needs_growth = impl->size > bucket_count / 4u * 3u;
+  rmw_spin_unlock(&impl->lock);
+  if (!needs_growth) {
+    return;
+  }
+  entry_t ** buckets = impl->allocator.zero_allocate(
+    bucket_count * 2u, sizeof(entry_t *), impl->allocator.state);
+  if (NULL == buckets) {
+    // Not an error, lookups only get slower.
+    return;
+  }
+  rmw_spin_lock(&impl->lock);
+  if (impl->bucket_count == bucket_count) {
+    rehash(impl, buckets);
+    buckets = NULL;
+  }
+  rmw_spin_unlock(&impl->lock);
+  if (NULL != buckets) {
+    // Another thread grew the table meanwhile.
+    impl->allocator.deallocate(buckets, impl->allocator.state);
+  }
+}
+
+rmw_string_table_t
+rmw_get_zero_initialized_string_table(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_string_table_t string_table;
+  return string_table;
+}
+
+rmw_ret_t
+rmw_string_table_init(rmw_string_table_t * table, const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+  if (NULL != table->impl) {
+    RMW_SET_ERROR_MSG("string table is already initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  rmw_string_table_impl_t * impl = allocator->zero_allocate(
+    1u, sizeof(rmw_string_table_impl_t), allocator->state);
+  if (NULL == impl) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for string table");
+    return RMW_RET_BAD_ALLOC;
+  }
+  impl->buckets = allocator->zero_allocate(
+    INITIAL_BUCKET_COUNT, sizeof(entry_t *), allocator->state);
+  if (NULL == impl->buckets) {
+    allocator->deallocate(impl, allocator->state);
+    RMW_SET_ERROR_MSG("failed to allocate memory for string table buckets");
+    return RMW_RET_BAD_ALLOC;
+  }
+  impl->allocator = *allocator;
+  atomic_init(&impl->lock, false);
+  impl->bucket_count = INITIAL_BUCKET_COUNT;
+  table->impl = impl;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_string_table_fini(rmw_string_table_t * table)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  rmw_string_table_impl_t * impl = table->impl;
+  if (NULL == impl) {
+    return RMW_RET_OK;
+  }
+  rcutils_allocator_t allocator = impl->allocator;
+  for (size_t i = 0u; i < impl->bucket_count; ++i) {
+    entry_t * entry = impl->buckets[i];
+    while (NULL != entry) {
+      entry_t * next = entry->next;
+      allocator.deallocate(entry, allocator.state);
+      entry = next;
+    }
+  }
+  allocator.deallocate(impl->buckets, allocator.state);
+  allocator.deallocate(impl, allocator.state);
+  table->impl = NULL;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_string_table_intern(
+  rmw_string_table_t * table,
+  const char * string,
+  const char ** interned)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(string, RMW_RET_INVALID_ARGUMENT);
+  return rmw_string_table_intern_with_size(table, string, strlen(string), interned);
+}
+
+rmw_ret_t
+rmw_string_table_intern_with_size(
+  rmw_string_table_t * table,
+  const char * string,
+  size_t length,
+  const char ** interned)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(string, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(interned, RMW_RET_INVALID_ARGUMENT);
+  rmw_string_table_impl_t * impl = table->impl;
+  if (NULL == impl) {
+    RMW_SET_ERROR_MSG("string table is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const uint64_t hash = hash_string(string, length);
+
+  rmw_spin_lock(&impl->lock);
+  entry_t * entry = find_entry(impl, string, length, hash);
+  rmw_spin_unlock(&impl->lock);
+  if (NULL != entry) {
+    *interned = entry->string;
+    return RMW_RET_OK;
+  }
+
+  if (length > SIZE_MAX - sizeof(entry_t) - 1u) {
+    RMW_SET_ERROR_MSG("string is too long to be interned");
+    return RMW_RET_BAD_ALLOC;
+  }
+  entry_t * new_entry = impl->allocator.allocate(
+    sizeof(entry_t) + length + 1u, impl->allocator.state);
+  if (NULL == new_entry) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for interned string");
+    return RMW_RET_BAD_ALLOC;
+  }
+  new_entry->hash = hash;
+  new_entry->length = length;
+  memcpy(new_entry->string, string, length);
+  new_entry->string[length] = '\0';
+
+  rmw_spin_lock(&impl->lock);
+  // Another thread may have interned the same string meanwhile.
+  entry = find_entry(impl, string, length, hash);
+  if (NULL == entry) {
+    entry_t ** bucket = &impl->buckets[hash & (impl->bucket_count - 1u)];
+    new_entry->next = *bucket;
+    *bucket = new_entry;
+    ++impl->size;
+    entry = new_entry;
+    new_entry = NULL;
+  }
+  rmw_spin_unlock(&impl->lock);
+  if (NULL != new_entry) {
+    impl->allocator.deallocate(new_entry, impl->allocator.state);
+  } else {
+    maybe_grow(impl);
+  }
+  *interned = entry->string;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_string_table_get_size(const rmw_string_table_t * table, size_t * size)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(size, RMW_RET_INVALID_ARGUMENT);
+  rmw_string_table_impl_t * impl = table->impl;
+  if (NULL == impl) {
+    RMW_SET_ERROR_MSG("string table is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  rmw_spin_lock(&impl->lock);
+  *size = impl->size;
+  rmw_spin_unlock(&impl->lock);
+  return RMW_RET_OK;
+}
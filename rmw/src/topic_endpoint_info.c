@@ -30,9 +30,12 @@ rmw_get_zero_initialized_topic_endpoint_info(void)
 rmw_ret_t
 _rmw_topic_endpoint_info_fini_str(
   const char ** topic_endpoint_info_str,
+  bool interned,
   rcutils_allocator_t * allocator)
 {
-  allocator->deallocate((char *) *topic_endpoint_info_str, allocator->state);
+  if (!interned) {
+    allocator->deallocate((char *) *topic_endpoint_info_str, allocator->state);
+  }
   *topic_endpoint_info_str = NULL;
   return RMW_RET_OK;
 }
@@ -42,7 +45,10 @@ _rmw_topic_endpoint_info_fini_node_name(
   rmw_topic_endpoint_info_t * topic_endpoint_info,
   rcutils_allocator_t * allocator)
 {
-  return _rmw_topic_endpoint_info_fini_str(&topic_endpoint_info->node_name, allocator);
+  return _rmw_topic_endpoint_info_fini_str(
+    &topic_endpoint_info->node_name,
+    topic_endpoint_info->interned_strings & RMW_TOPIC_ENDPOINT_INFO_NODE_NAME_INTERNED,
+    allocator);
 }
 
 rmw_ret_t
@@ -50,7 +56,10 @@ _rmw_topic_endpoint_info_fini_node_namespace(
   rmw_topic_endpoint_info_t * topic_endpoint_info,
   rcutils_allocator_t * allocator)
 {
-  return _rmw_topic_endpoint_info_fini_str(&topic_endpoint_info->node_namespace, allocator);
+  return _rmw_topic_endpoint_info_fini_str(
+    &topic_endpoint_info->node_namespace,
+    topic_endpoint_info->interned_strings & RMW_TOPIC_ENDPOINT_INFO_NODE_NAMESPACE_INTERNED,
+    allocator);
 }
 
 rmw_ret_t
@@ -58,7 +67,10 @@ _rmw_topic_endpoint_info_fini_topic_type(
   rmw_topic_endpoint_info_t * topic_endpoint_info,
   rcutils_allocator_t * allocator)
 {
-  return _rmw_topic_endpoint_info_fini_str(&topic_endpoint_info->topic_type, allocator);
+  return _rmw_topic_endpoint_info_fini_str(
+    &topic_endpoint_info->topic_type,
+    topic_endpoint_info->interned_strings & RMW_TOPIC_ENDPOINT_INFO_TOPIC_TYPE_INTERNED,
+    allocator);
 }
 
 rmw_ret_t
@@ -128,6 +140,34 @@ _rmw_topic_endpoint_info_copy_str(
   return RMW_RET_OK;
 }
 
+rmw_ret_t
+_rmw_topic_endpoint_info_intern_str(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char ** topic_endpoint_info_str,
+  uint8_t interned_flag,
+  const char * str,
+  rmw_string_table_t * string_table)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_BAD_ALLOC);
+
+  if (!str) {
+    RMW_SET_ERROR_MSG("str is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  if (!string_table) {
+    RMW_SET_ERROR_MSG("string_table is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  rmw_ret_t ret = rmw_string_table_intern(string_table, str, topic_endpoint_info_str);
+  if (ret == RMW_RET_OK) {
+    topic_endpoint_info->interned_strings |= interned_flag;
+  }
+  return ret;
+}
+
 rmw_ret_t
 rmw_topic_endpoint_info_set_topic_type(
   rmw_topic_endpoint_info_t * topic_endpoint_info,
@@ -140,7 +180,32 @@ rmw_topic_endpoint_info_set_topic_type(
     RMW_SET_ERROR_MSG("topic_endpoint_info is null");
     return RMW_RET_INVALID_ARGUMENT;
   }
-  return _rmw_topic_endpoint_info_copy_str(&topic_endpoint_info->topic_type, topic_type, allocator);
+  rmw_ret_t ret = _rmw_topic_endpoint_info_copy_str(
+    &topic_endpoint_info->topic_type, topic_type, allocator);
+  if (ret == RMW_RET_OK) {
+    topic_endpoint_info->interned_strings &= ~RMW_TOPIC_ENDPOINT_INFO_TOPIC_TYPE_INTERNED;
+  }
+  return ret;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_set_topic_type_interned(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char * topic_type,
+  rmw_string_table_t * string_table)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_INVALID_ARGUMENT);
+
+  if (!topic_endpoint_info) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return _rmw_topic_endpoint_info_intern_str(
+    topic_endpoint_info,
+    &topic_endpoint_info->topic_type,
+    RMW_TOPIC_ENDPOINT_INFO_TOPIC_TYPE_INTERNED,
+    topic_type,
+    string_table);
 }
 
 rmw_ret_t
@@ -167,7 +232,32 @@ rmw_topic_endpoint_info_set_node_name(
     RMW_SET_ERROR_MSG("topic_endpoint_info is null");
     return RMW_RET_INVALID_ARGUMENT;
   }
-  return _rmw_topic_endpoint_info_copy_str(&topic_endpoint_info->node_name, node_name, allocator);
+  rmw_ret_t ret = _rmw_topic_endpoint_info_copy_str(
+    &topic_endpoint_info->node_name, node_name, allocator);
+  if (ret == RMW_RET_OK) {
+    topic_endpoint_info->interned_strings &= ~RMW_TOPIC_ENDPOINT_INFO_NODE_NAME_INTERNED;
+  }
+  return ret;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_set_node_name_interned(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char * node_name,
+  rmw_string_table_t * string_table)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_INVALID_ARGUMENT);
+
+  if (!topic_endpoint_info) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return _rmw_topic_endpoint_info_intern_str(
+    topic_endpoint_info,
+    &topic_endpoint_info->node_name,
+    RMW_TOPIC_ENDPOINT_INFO_NODE_NAME_INTERNED,
+    node_name,
+    string_table);
 }
 
 rmw_ret_t
@@ -182,10 +272,34 @@ rmw_topic_endpoint_info_set_node_namespace(
     RMW_SET_ERROR_MSG("topic_endpoint_info is null");
     return RMW_RET_INVALID_ARGUMENT;
   }
-  return _rmw_topic_endpoint_info_copy_str(
+  rmw_ret_t ret = _rmw_topic_endpoint_info_copy_str(
     &topic_endpoint_info->node_namespace,
     node_namespace,
     allocator);
+  if (ret == RMW_RET_OK) {
+    topic_endpoint_info->interned_strings &= ~RMW_TOPIC_ENDPOINT_INFO_NODE_NAMESPACE_INTERNED;
+  }
+  return ret;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_set_node_namespace_interned(
+  rmw_topic_endpoint_info_t * topic_endpoint_info,
+  const char * node_namespace,
+  rmw_string_table_t * string_table)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RMW_RET_INVALID_ARGUMENT);
+
+  if (!topic_endpoint_info) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return _rmw_topic_endpoint_info_intern_str(
+    topic_endpoint_info,
+    &topic_endpoint_info->node_namespace,
+    RMW_TOPIC_ENDPOINT_INFO_NODE_NAMESPACE_INTERNED,
+    node_namespace,
+    string_table);
 }
 
 rmw_ret_t
@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include "rmw/topic_endpoint_info_array.h"
+
+#include <stdlib.h>
+#include <string.h>
+
 #include "rmw/error_handling.h"
 #include "rmw/types.h"
 
@@ -95,3 +99,33 @@ rmw_topic_endpoint_info_array_fini(
   topic_endpoint_info_array->size = 0;
   return RMW_RET_OK;
 }
+
+static int
+compare_gids(const void * lhs, const void * rhs)
+{
+  return memcmp(
+    ((const rmw_topic_endpoint_info_t *)lhs)->endpoint_gid,
+    ((const rmw_topic_endpoint_info_t *)rhs)->endpoint_gid,
+    RMW_GID_STORAGE_SIZE);
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_array_sort_by_gid(
+  rmw_topic_endpoint_info_array_t * topic_endpoint_info_array)
+{
+  if (!topic_endpoint_info_array) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info_array is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (topic_endpoint_info_array->size == 0u) {
+    return RMW_RET_OK;
+  }
+  if (!topic_endpoint_info_array->info_array) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info_array has no storage");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  qsort(
+    topic_endpoint_info_array->info_array, topic_endpoint_info_array->size,
+    sizeof(rmw_topic_endpoint_info_t), compare_gids);
+  return RMW_RET_OK;
+}
@@ -0,0 +1,274 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/topic_endpoint_info_index.h"
+
+#include <string.h>
+
+#include "rmw/error_handling.h"
+
+#if RMW_GID_STORAGE_SIZE != 16u
+#error "rmw_topic_endpoint_info_index_t GID hashing assumes 16 bytes GIDs"
+#endif
+
+// GIDs of endpoints of the same participant share most of their bytes, mix them all.
+static uint64_t
+hash_gid(const uint8_t * gid)
+{
+  uint64_t high;
+  uint64_t low;
+  memcpy(&high, gid, sizeof(high));
+  memcpy(&low, gid + sizeof(high), sizeof(low));
+  uint64_t hash = high * UINT64_C(0x9e3779b97f4a7c15) ^ low;
+  hash ^= hash >> 32;
+  hash *= UINT64_C(0xd6e8feb86659fd93);
+  hash ^= hash >> 32;
+  return hash;
+}
+
+// 64-bit FNV-1a over the namespace and name, with a null character in between.
+static uint64_t
+hash_node(const char * node_name, const char * node_namespace)
+{
+  uint64_t hash = UINT64_C(14695981039346656037);
+  for (const char * c = node_namespace; ; ++c) {
+    hash ^= (uint8_t)*c;
+    hash *= UINT64_C(1099511628211);
+    if ('\0' == *c) {
+      break;
+    }
+  }
+  for (const char * c = node_name; '\0' != *c; ++c) {
+    hash ^= (uint8_t)*c;
+    hash *= UINT64_C(1099511628211);
+  }
+  return hash;
+}
+
+static bool
+has_node(const rmw_topic_endpoint_info_t * info)
+{
+  return NULL != info->node_name && NULL != info->node_namespace;
+}
+
+static bool
+is_node(const rmw_topic_endpoint_info_t * info, const char * node_name, const char * node_namespace)
+{
+  return 0 == strcmp(info->node_name, node_name) &&
+         0 == strcmp(info->node_namespace, node_namespace);
+}
+
+static void
+insert_gid(size_t * slots, size_t capacity, const uint8_t * gid, size_t position)
+{
+  size_t slot = (size_t)hash_gid(gid) & (capacity - 1u);
+  while (0u != slots[slot]) {
+    slot = (slot + 1u) & (capacity - 1u);
+  }
+  slots[slot] = position + 1u;
+}
+
+// Return the slot of the given node, or the empty slot it would take.
+static size_t
+find_node_slot(
+  const size_t * slots,
+  size_t capacity,
+  const rmw_topic_endpoint_info_t * info_array,
+  const char * node_name,
+  const char * node_namespace)
+{
+  size_t slot = (size_t)hash_node(node_name, node_namespace) & (capacity - 1u);
+  while (
+    0u != slots[slot] && !is_node(&info_array[slots[slot] - 1u], node_name, node_namespace))
+  {
+    slot = (slot + 1u) & (capacity - 1u);
+  }
+  return slot;
+}
+
+static rmw_ret_t
+check_initialized(const rmw_topic_endpoint_info_index_t * index)
+{
+  if (NULL == index->gid_slots) {
+    RMW_SET_ERROR_MSG("topic endpoint info index is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return RMW_RET_OK;
+}
+
+rmw_topic_endpoint_info_index_t
+rmw_get_zero_initialized_topic_endpoint_info_index(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_topic_endpoint_info_index_t zero;
+  return zero;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_index_init(
+  rmw_topic_endpoint_info_index_t * index,
+  const rmw_topic_endpoint_info_array_t * topic_endpoint_info_array,
+  bool index_nodes,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(index, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_endpoint_info_array, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  if (NULL != index->gid_slots || NULL != index->topic_endpoint_info_array) {
+    RMW_SET_ERROR_MSG("topic endpoint info index is not zero initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const size_t size = topic_endpoint_info_array->size;
+  const rmw_topic_endpoint_info_t * info_array = topic_endpoint_info_array->info_array;
+  if (0u != size && NULL == info_array) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info_array has no storage");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  // The capacity is below 4 * size, so the node table and chains hold below 5 * size slots.
+  if (size > SIZE_MAX / 8u) {
+    RMW_SET_ERROR_MSG("topic_endpoint_info_array is too large to be indexed");
+    return RMW_RET_BAD_ALLOC;
+  }
+  // Keep tables at most half full, so probe sequences stay short.
+  size_t capacity = 2u;
+  while (capacity < 2u * size) {
+    capacity *= 2u;
+  }
+  size_t * gid_slots = allocator->zero_allocate(capacity, sizeof(size_t), allocator->state);
+  if (NULL == gid_slots) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for topic endpoint info index");
+    return RMW_RET_BAD_ALLOC;
+  }
+  size_t * node_slots = NULL;
+  if (index_nodes) {
+    // The chains of elements of each node follow the table, in the same block.
+    node_slots = allocator->zero_allocate(capacity + size, sizeof(size_t), allocator->state);
+    if (NULL == node_slots) {
+      allocator->deallocate(gid_slots, allocator->state);
+      RMW_SET_ERROR_MSG("failed to allocate memory for topic endpoint info node index");
+      return RMW_RET_BAD_ALLOC;
+    }
+  }
+  for (size_t i = 0u; i < size; ++i) {
+    insert_gid(gid_slots, capacity, info_array[i].endpoint_gid, i);
+  }
+  size_t * node_next = NULL;
+  if (NULL != node_slots) {
+    node_next = node_slots + capacity;
+    // Push elements in reverse onto the chain of their node, so chains follow array order.
+    for (size_t i = size; i-- > 0u; ) {
+      if (!has_node(&info_array[i])) {
+        continue;
+      }
+      const size_t slot = find_node_slot(
+        node_slots, capacity, info_array, info_array[i].node_name, info_array[i].node_namespace);
+      node_next[i] = node_slots[slot];
+      node_slots[slot] = i + 1u;
+    }
+  }
+  index->topic_endpoint_info_array = topic_endpoint_info_array;
+  index->capacity = capacity;
+  index->gid_slots = gid_slots;
+  index->node_slots = node_slots;
+  index->node_next = node_next;
+  index->allocator = *allocator;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_index_fini(rmw_topic_endpoint_info_index_t * index)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(index, RMW_RET_INVALID_ARGUMENT);
+  if (NULL != index->gid_slots) {
+    index->allocator.deallocate(index->gid_slots, index->allocator.state);
+  }
+  if (NULL != index->node_slots) {
+    index->allocator.deallocate(index->node_slots, index->allocator.state);
+  }
+  *index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_index_find_by_gid(
+  const rmw_topic_endpoint_info_index_t * index,
+  const uint8_t * endpoint_gid,
+  const rmw_topic_endpoint_info_t ** topic_endpoint_info)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(index, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(endpoint_gid, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_endpoint_info, RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret = check_initialized(index);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  const rmw_topic_endpoint_info_t * info_array = index->topic_endpoint_info_array->info_array;
+  const size_t mask = index->capacity - 1u;
+  for (size_t slot = (size_t)hash_gid(endpoint_gid) & mask; 0u != index->gid_slots[slot];
+    slot = (slot + 1u) & mask)
+  {
+    const rmw_topic_endpoint_info_t * info = &info_array[index->gid_slots[slot] - 1u];
+    if (0 == memcmp(info->endpoint_gid, endpoint_gid, RMW_GID_STORAGE_SIZE)) {
+      *topic_endpoint_info = info;
+      return RMW_RET_OK;
+    }
+  }
+  *topic_endpoint_info = NULL;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_topic_endpoint_info_index_find_by_node(
+  const rmw_topic_endpoint_info_index_t * index,
+  const char * node_name,
+  const char * node_namespace,
+  const rmw_topic_endpoint_info_t * previous,
+  const rmw_topic_endpoint_info_t ** topic_endpoint_info)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(index, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(node_name, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(node_namespace, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_endpoint_info, RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret = check_initialized(index);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  if (NULL == index->node_slots) {
+    RMW_SET_ERROR_MSG("topic endpoint info index does not index nodes");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const rmw_topic_endpoint_info_t * info_array = index->topic_endpoint_info_array->info_array;
+  size_t next;
+  if (NULL == previous) {
+    next = index->node_slots[find_node_slot(
+        index->node_slots, index->capacity, info_array, node_name, node_namespace)];
+  } else {
+    // Compare addresses as integers, previous may point anywhere.
+    const uintptr_t offset = (uintptr_t)previous - (uintptr_t)info_array;
+    const size_t position = offset / sizeof(rmw_topic_endpoint_info_t);
+    if (
+      (uintptr_t)previous < (uintptr_t)info_array ||
+      0u != offset % sizeof(rmw_topic_endpoint_info_t) ||
+      position >= index->topic_endpoint_info_array->size ||
+      !has_node(previous) || !is_node(previous, node_name, node_namespace))
+    {
+      RMW_SET_ERROR_MSG("previous is not an element of the indexed array of the given node");
+      return RMW_RET_INVALID_ARGUMENT;
+    }
+    next = index->node_next[position];
+  }
+  *topic_endpoint_info = 0u != next ? &info_array[next - 1u] : NULL;
+  return RMW_RET_OK;
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/topic_filter.h"
+
+#include <string.h>
+
+#include "rmw/error_handling.h"
+
+rmw_topic_filter_t
+rmw_get_zero_initialized_topic_filter(void)
+{
+  // All members are initialized to 0 or NULL by C99 6.7.8/10.
+  static const rmw_topic_filter_t topic_filter;
+  return topic_filter;
+}
+
+static bool
+match(const char * pattern, const char * name)
+{
+  // Where to resume after the last `*`, which may absorb one more character of its token.
+  const char * star_pattern = NULL;
+  const char * star_name = NULL;
+  // Where to resume after the last `**`, which may absorb one more character of any kind.
+  // Any earlier wildcard can only absorb what the last `**` can, so it is not tracked.
+  const char * globstar_pattern = NULL;
+  const char * globstar_name = NULL;
+  while ('\0' != *name) {
+    if ('*' == pattern[0] && '*' == pattern[1]) {
+      pattern += 2;
+      globstar_pattern = pattern;
+      globstar_name = name;
+      star_pattern = NULL;
+      continue;
+    }
+    if ('*' == *pattern) {
+      ++pattern;
+      star_pattern = pattern;
+      star_name = name;
+      continue;
+    }
+    if (('?' == *pattern && '/' != *name) || ('\0' != *pattern && *pattern == *name)) {
+      ++pattern;
+      ++name;
+      continue;
+    }
+    if (NULL != star_pattern && '/' != *star_name) {
+      pattern = star_pattern;
+      name = ++star_name;
+      continue;
+    }
+    if (NULL != globstar_pattern) {
+      star_pattern = NULL;
+      pattern = globstar_pattern;
+      name = ++globstar_name;
+      continue;
+    }
+    return false;
+  }
+  // Trailing wildcards match the empty sequence
+  while ('*' == *pattern) {
+    ++pattern;
+  }
+  return '\0' == *pattern;
+}
+
+rmw_ret_t
+rmw_topic_name_matches(const char * pattern, const char * topic_name, bool * matches)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(pattern, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_name, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(matches, RMW_RET_INVALID_ARGUMENT);
+  *matches = '\0' == *pattern || match(pattern, topic_name);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_topic_pattern_get_prefix_length(const char * pattern, size_t * prefix_length)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(pattern, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(prefix_length, RMW_RET_INVALID_ARGUMENT);
+  *prefix_length = strcspn(pattern, "*?");
+  return RMW_RET_OK;
+}
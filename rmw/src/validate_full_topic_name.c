@@ -14,10 +14,10 @@
 
 #include <rmw/validate_full_topic_name.h>
 
-#include <ctype.h>
 #include <string.h>
 
-#include "rcutils/isalnum_no_locale.h"
+#include "./name_scanner_impl.h"
+#include "./validate_names_batch_impl.h"
 
 rmw_ret_t
 rmw_validate_full_topic_name(
@@ -32,6 +32,25 @@ rmw_validate_full_topic_name(
     topic_name, strlen(topic_name), validation_result, invalid_index);
 }
 
+// Check a fully qualified topic name, whose arguments are known to be valid.
+static int
+check_full_topic_name(const char * topic_name, size_t topic_name_length, size_t * invalid_index)
+{
+  int result = rmw_check_absolute_name(topic_name, topic_name_length, invalid_index);
+  if (result != RMW_TOPIC_VALID) {
+    return result;
+  }
+  // check if the topic name is too long last, since it might be a soft invalidation
+  if (topic_name_length > RMW_TOPIC_MAX_NAME_LENGTH) {
+    if (invalid_index) {
+      *invalid_index = RMW_TOPIC_MAX_NAME_LENGTH - 1;
+    }
+    return RMW_TOPIC_INVALID_TOO_LONG;
+  }
+  // everything was ok, it is a valid topic, avoid setting invalid_index
+  return RMW_TOPIC_VALID;
+}
+
 rmw_ret_t
 rmw_validate_full_topic_name_with_size(
   const char * topic_name,
@@ -45,87 +64,21 @@ rmw_validate_full_topic_name_with_size(
   if (!validation_result) {
     return RMW_RET_INVALID_ARGUMENT;
   }
-  if (topic_name_length == 0) {
-    *validation_result = RMW_TOPIC_INVALID_IS_EMPTY_STRING;
-    if (invalid_index) {
-      *invalid_index = 0;
-    }
-    return RMW_RET_OK;
-  }
-  if (topic_name[0] != '/') {
-    *validation_result = RMW_TOPIC_INVALID_NOT_ABSOLUTE;
-    if (invalid_index) {
-      *invalid_index = 0;
-    }
-    return RMW_RET_OK;
-  }
-  // note topic_name_length is >= 1 at this point
-  if (topic_name[topic_name_length - 1] == '/') {
-    // catches both "/foo/" and "/"
-    *validation_result = RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH;
-    if (invalid_index) {
-      *invalid_index = topic_name_length - 1;
-    }
-    return RMW_RET_OK;
-  }
-  // check for unallowed characters
-  for (size_t i = 0; i < topic_name_length; ++i) {
-    if (rcutils_isalnum_no_locale(topic_name[i])) {
-      // if it is an alpha numeric character, i.e. [0-9|A-Z|a-z], continue
-      continue;
-    } else if (topic_name[i] == '_') {
-      // if it is an underscore, continue
-      continue;
-    } else if (topic_name[i] == '/') {
-      // if it is a forward slash, continue
-      continue;
-    } else {
-      // if it is none of these, then it is an unallowed character in a FQN topic name
-      *validation_result = RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-      if (invalid_index) {
-        *invalid_index = i;
-      }
-      return RMW_RET_OK;
-    }
-  }
-  // check for double '/' and tokens that start with a number
-  for (size_t i = 0; i < topic_name_length; ++i) {
-    if (i == topic_name_length - 1) {
-      // if this is the last character, then nothing to check
-      continue;
-    }
-    // past this point, assuming i+1 is a valid index
-    if (topic_name[i] == '/') {
-      if (topic_name[i + 1] == '/') {
-        *validation_result = RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
-        if (invalid_index) {
-          *invalid_index = i + 1;
-        }
-        return RMW_RET_OK;
-      }
-      if (isdigit(topic_name[i + 1]) != 0) {
-        // this is the case where a '/' if followed by a number, i.e. [0-9]
-        *validation_result = RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
-        if (invalid_index) {
-          *invalid_index = i + 1;
-        }
-        return RMW_RET_OK;
-      }
-    }
-  }
-  // check if the topic name is too long last, since it might be a soft invalidation
-  if (topic_name_length > RMW_TOPIC_MAX_NAME_LENGTH) {
-    *validation_result = RMW_TOPIC_INVALID_TOO_LONG;
-    if (invalid_index) {
-      *invalid_index = RMW_TOPIC_MAX_NAME_LENGTH - 1;
-    }
-    return RMW_RET_OK;
-  }
-  // everything was ok, set result to valid topic, avoid setting invalid_index, and return
-  *validation_result = RMW_TOPIC_VALID;
+  *validation_result = check_full_topic_name(topic_name, topic_name_length, invalid_index);
   return RMW_RET_OK;
 }
 
+rmw_ret_t
+rmw_validate_full_topic_names_batch(
+  const rcutils_string_array_t * topic_names,
+  const size_t * lengths,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  return rmw_validate_names_batch(
+    topic_names, lengths, check_full_topic_name, validation_results, invalid_indices);
+}
+
 const char *
 rmw_full_topic_name_validation_result_string(int validation_result)
 {
@@ -0,0 +1,74 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VALIDATE_NAMES_BATCH_IMPL_H_
+#define VALIDATE_NAMES_BATCH_IMPL_H_
+
+#include <stddef.h>
+#include <string.h>
+
+#include "rcutils/types/string_array.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/ret_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Check a name whose arguments are known to be valid, returning its validation result.
+/**
+ * The invalid index is stored in `invalid_index`, if not NULL, when the name is invalid.
+ */
+typedef int (* rmw_name_checker_t)(const char * name, size_t name_length, size_t * invalid_index);
+
+/// Validate all names of an array with `check`, as the rmw_validate_*_batch() functions do.
+/**
+ * Arguments are checked once for the whole array.
+ * This is inlined into each rmw_validate_*_batch() function, along with its `check`, so
+ * names are validated without a call per name.
+ */
+static inline rmw_ret_t
+rmw_validate_names_batch(
+  const rcutils_string_array_t * names,
+  const size_t * lengths,
+  rmw_name_checker_t check,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(names, RMW_RET_INVALID_ARGUMENT);
+  if (0u == names->size) {
+    return RMW_RET_OK;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(names->data, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(validation_results, RMW_RET_INVALID_ARGUMENT);
+  for (size_t i = 0u; i < names->size; ++i) {
+    const char * name = names->data[i];
+    if (NULL == name) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("name at index %zu is null", i);
+      return RMW_RET_INVALID_ARGUMENT;
+    }
+    validation_results[i] = check(
+      name, NULL == lengths ? strlen(name) : lengths[i],
+      NULL == invalid_indices ? NULL : &invalid_indices[i]);
+  }
+  return RMW_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VALIDATE_NAMES_BATCH_IMPL_H_
@@ -14,15 +14,26 @@
 
 #include "rmw/validate_namespace.h"
 
-#include <ctype.h>
-#include <stdio.h>
 #include <string.h>
 
-#include <rcutils/snprintf.h>
-
-#include "rmw/error_handling.h"
 #include "rmw/validate_full_topic_name.h"
 
+#include "./name_scanner_impl.h"
+#include "./validate_names_batch_impl.h"
+
+#if RMW_NAMESPACE_VALID != RMW_TOPIC_VALID || \
+  RMW_NAMESPACE_INVALID_IS_EMPTY_STRING != RMW_TOPIC_INVALID_IS_EMPTY_STRING || \
+  RMW_NAMESPACE_INVALID_NOT_ABSOLUTE != RMW_TOPIC_INVALID_NOT_ABSOLUTE || \
+  RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH != RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH || \
+  RMW_NAMESPACE_INVALID_CONTAINS_UNALLOWED_CHARACTERS != \
+  RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS || \
+  RMW_NAMESPACE_INVALID_CONTAINS_REPEATED_FORWARD_SLASH != \
+  RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH || \
+  RMW_NAMESPACE_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER != \
+  RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER
+#error "namespace validation results must match the topic name ones they are shared with"
+#endif
+
 rmw_ret_t
 rmw_validate_namespace(
   const char * namespace_,
@@ -36,92 +47,63 @@ rmw_validate_namespace(
     namespace_, strlen(namespace_), validation_result, invalid_index);
 }
 
-rmw_ret_t
-rmw_validate_namespace_with_size(
-  const char * namespace_,
-  size_t namespace_length,
-  int * validation_result,
-  size_t * invalid_index)
+// Check a namespace, whose arguments are known to be valid.
+static int
+check_namespace(const char * namespace_, size_t namespace_length, size_t * invalid_index)
 {
-  if (!namespace_) {
-    return RMW_RET_INVALID_ARGUMENT;
-  }
-  if (!validation_result) {
-    return RMW_RET_INVALID_ARGUMENT;
-  }
-
   // Special case for root namepsace
   if (namespace_length == 1 && namespace_[0] == '/') {
     // Ok to return here, it is valid and will not exceed RMW_NAMESPACE_MAX_LENGTH.
-    *validation_result = RMW_NAMESPACE_VALID;
-    return RMW_RET_OK;
-  }
-
-  // All other cases should pass the validate topic name test.
-  int t_validation_result;
-  size_t t_invalid_index;
-  rmw_ret_t ret = rmw_validate_full_topic_name(namespace_, &t_validation_result, &t_invalid_index);
-  if (ret != RMW_RET_OK) {
-    // error already set
-    return ret;
+    return RMW_NAMESPACE_VALID;
   }
 
-  if (t_validation_result != RMW_TOPIC_VALID && t_validation_result != RMW_TOPIC_INVALID_TOO_LONG) {
-    switch (t_validation_result) {
-      case RMW_TOPIC_INVALID_IS_EMPTY_STRING:
-        *validation_result = RMW_NAMESPACE_INVALID_IS_EMPTY_STRING;
-        break;
-      case RMW_TOPIC_INVALID_NOT_ABSOLUTE:
-        *validation_result = RMW_NAMESPACE_INVALID_NOT_ABSOLUTE;
-        break;
-      case RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH:
-        *validation_result = RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH;
-        break;
-      case RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS:
-        *validation_result = RMW_NAMESPACE_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-        break;
-      case RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH:
-        *validation_result = RMW_NAMESPACE_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
-        break;
-      case RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER:
-        *validation_result = RMW_NAMESPACE_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
-        break;
-      default:
-        {
-          char default_err_msg[256];
-          // explicitly not taking return value which is number of bytes written
-          int ret = rcutils_snprintf(
-            default_err_msg, sizeof(default_err_msg),
-            "rmw_validate_namespace(): unknown rmw_validate_full_topic_name() result '%d'",
-            t_validation_result);
-          if (ret < 0) {
-            RMW_SET_ERROR_MSG("rmw_validate_namespace(): rcutils_snprintf() failed");
-          } else {
-            RMW_SET_ERROR_MSG(default_err_msg);
-          }
-        }
-        return RMW_RET_ERROR;
-    }
-    if (invalid_index) {
-      *invalid_index = t_invalid_index;
-    }
-    return RMW_RET_OK;
+  // All other cases follow the rules of topic names, but for their length limit.
+  int result = rmw_check_absolute_name(namespace_, namespace_length, invalid_index);
+  if (result != RMW_TOPIC_VALID) {
+    // namespace results have the values of their topic counterparts, as checked above
+    return result;
   }
 
   // check if the namespace is too long last, since it might be a soft invalidation
   if (namespace_length > RMW_NAMESPACE_MAX_LENGTH) {
-    *validation_result = RMW_NAMESPACE_INVALID_TOO_LONG;
     if (invalid_index) {
       *invalid_index = RMW_NAMESPACE_MAX_LENGTH - 1;
     }
-    return RMW_RET_OK;
+    return RMW_NAMESPACE_INVALID_TOO_LONG;
   }
 
-  // everything was ok, set result to valid namespace, avoid setting invalid_index, and return
-  *validation_result = RMW_NAMESPACE_VALID;
+  // everything was ok, it is a valid namespace, avoid setting invalid_index
+  return RMW_NAMESPACE_VALID;
+}
+
+rmw_ret_t
+rmw_validate_namespace_with_size(
+  const char * namespace_,
+  size_t namespace_length,
+  int * validation_result,
+  size_t * invalid_index)
+{
+  if (!namespace_) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (!validation_result) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *validation_result = check_namespace(namespace_, namespace_length, invalid_index);
   return RMW_RET_OK;
 }
 
+rmw_ret_t
+rmw_validate_namespaces_batch(
+  const rcutils_string_array_t * namespaces,
+  const size_t * lengths,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  return rmw_validate_names_batch(
+    namespaces, lengths, check_namespace, validation_results, invalid_indices);
+}
+
 const char *
 rmw_namespace_validation_result_string(int validation_result)
 {
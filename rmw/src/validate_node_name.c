@@ -17,7 +17,8 @@
 #include <ctype.h>
 #include <string.h>
 
-#include "rcutils/isalnum_no_locale.h"
+#include "./name_scanner_impl.h"
+#include "./validate_names_batch_impl.h"
 
 rmw_ret_t
 rmw_validate_node_name(
@@ -32,64 +33,72 @@ rmw_validate_node_name(
     node_name, strlen(node_name), validation_result, invalid_index);
 }
 
-rmw_ret_t
-rmw_validate_node_name_with_size(
-  const char * node_name,
-  size_t node_name_length,
-  int * validation_result,
-  size_t * invalid_index)
+// Check a node name, whose arguments are known to be valid.
+static int
+check_node_name(const char * node_name, size_t node_name_length, size_t * invalid_index)
 {
-  if (!node_name) {
-    return RMW_RET_INVALID_ARGUMENT;
-  }
-  if (!validation_result) {
-    return RMW_RET_INVALID_ARGUMENT;
-  }
   if (node_name_length == 0) {
-    *validation_result = RMW_NODE_NAME_INVALID_IS_EMPTY_STRING;
     if (invalid_index) {
       *invalid_index = 0;
     }
-    return RMW_RET_OK;
+    return RMW_NODE_NAME_INVALID_IS_EMPTY_STRING;
   }
   // check for unallowed characters
-  for (size_t i = 0; i < node_name_length; ++i) {
-    if (rcutils_isalnum_no_locale(node_name[i])) {
-      // if it is an alpha numeric character, i.e. [0-9|A-Z|a-z], continue
-      continue;
-    } else if (node_name[i] == '_') {
-      // if it is an underscore, continue
-      continue;
-    } else {
-      // if it is none of these, then it is an unallowed character in a node name
-      *validation_result = RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-      if (invalid_index) {
-        *invalid_index = i;
-      }
-      return RMW_RET_OK;
+  rmw_name_scan_t scan;
+  rmw_scan_name(node_name, node_name_length, false, &scan);
+  if (scan.first_unallowed < node_name_length) {
+    // it is none of alphanumerics or '_', so it is an unallowed character in a node name
+    if (invalid_index) {
+      *invalid_index = scan.first_unallowed;
     }
+    return RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
   }
   if (isdigit(node_name[0]) != 0) {
     // this is the case where the name starts with a number, i.e. [0-9]
-    *validation_result = RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER;
     if (invalid_index) {
       *invalid_index = 0;
     }
-    return RMW_RET_OK;
+    return RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER;
   }
   // check if the node name is too long last, since it might be a soft invalidation
   if (node_name_length > RMW_NODE_NAME_MAX_NAME_LENGTH) {
-    *validation_result = RMW_NODE_NAME_INVALID_TOO_LONG;
     if (invalid_index) {
       *invalid_index = RMW_NODE_NAME_MAX_NAME_LENGTH - 1;
     }
-    return RMW_RET_OK;
+    return RMW_NODE_NAME_INVALID_TOO_LONG;
+  }
+  // everything was ok, it is a valid node name, avoid setting invalid_index
+  return RMW_NODE_NAME_VALID;
+}
+
+rmw_ret_t
+rmw_validate_node_name_with_size(
+  const char * node_name,
+  size_t node_name_length,
+  int * validation_result,
+  size_t * invalid_index)
+{
+  if (!node_name) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (!validation_result) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  // everything was ok, set result to valid node name, avoid setting invalid_index, and return
-  *validation_result = RMW_NODE_NAME_VALID;
+  *validation_result = check_node_name(node_name, node_name_length, invalid_index);
   return RMW_RET_OK;
 }
 
+rmw_ret_t
+rmw_validate_node_names_batch(
+  const rcutils_string_array_t * node_names,
+  const size_t * lengths,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  return rmw_validate_names_batch(
+    node_names, lengths, check_node_name, validation_results, invalid_indices);
+}
+
 const char *
 rmw_node_name_validation_result_string(int validation_result)
 {
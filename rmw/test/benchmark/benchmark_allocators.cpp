@@ -0,0 +1,116 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/allocators.h"
+#include "rmw/entity_pool.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Sizes are a small entity struct, and wait set arrays of 1k and 128k handles.
+#define ALLOCATION_SIZES \
+  Arg(sizeof(rmw_publisher_t))->Arg(1024 * sizeof(void *))->Arg(128 * 1024 * sizeof(void *))
+
+// What rmw_allocate() used to do: allocate, then clear the whole block.
+BENCHMARK_DEFINE_F(PerformanceTest, allocate_then_memset)(benchmark::State & st)
+{
+  const size_t size = static_cast<size_t>(st.range(0));
+  reset_heap_counters();
+  for (auto _ : st) {
+    void * ptr = rmw_allocate_uninitialized(size);
+    if (!ptr) {
+      st.SkipWithError("rmw_allocate_uninitialized failed");
+      break;
+    }
+    std::memset(ptr, 0, size);
+    benchmark::DoNotOptimize(ptr);
+    rmw_free(ptr);
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, allocate_then_memset)->ALLOCATION_SIZES;
+
+BENCHMARK_DEFINE_F(PerformanceTest, rmw_allocate)(benchmark::State & st)
+{
+  const size_t size = static_cast<size_t>(st.range(0));
+  reset_heap_counters();
+  for (auto _ : st) {
+    void * ptr = rmw_allocate(size);
+    if (!ptr) {
+      st.SkipWithError("rmw_allocate failed");
+      break;
+    }
+    benchmark::DoNotOptimize(ptr);
+    rmw_free(ptr);
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, rmw_allocate)->ALLOCATION_SIZES;
+
+BENCHMARK_DEFINE_F(PerformanceTest, rmw_allocate_uninitialized)(benchmark::State & st)
+{
+  const size_t size = static_cast<size_t>(st.range(0));
+  reset_heap_counters();
+  for (auto _ : st) {
+    void * ptr = rmw_allocate_uninitialized(size);
+    if (!ptr) {
+      st.SkipWithError("rmw_allocate_uninitialized failed");
+      break;
+    }
+    benchmark::DoNotOptimize(ptr);
+    rmw_free(ptr);
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, rmw_allocate_uninitialized)->ALLOCATION_SIZES;
+
+BENCHMARK_F(PerformanceTest, rmw_publisher_allocate_heap)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_publisher_t * publisher = rmw_publisher_allocate();
+    if (!publisher) {
+      st.SkipWithError("rmw_publisher_allocate failed");
+      break;
+    }
+    benchmark::DoNotOptimize(publisher);
+    rmw_publisher_free(publisher);
+  }
+}
+
+BENCHMARK_F(PerformanceTest, rmw_publisher_allocate_pool)(benchmark::State & st)
+{
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  options.capacity[RMW_ENTITY_POOL_PUBLISHER] = 16u;
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  if (RMW_RET_OK != rmw_entity_pools_init(&options, &allocator)) {
+    st.SkipWithError("rmw_entity_pools_init failed");
+    return;
+  }
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_publisher_t * publisher = rmw_publisher_allocate();
+    if (!publisher) {
+      st.SkipWithError("rmw_publisher_allocate failed");
+      break;
+    }
+    benchmark::DoNotOptimize(publisher);
+    rmw_publisher_free(publisher);
+  }
+  if (RMW_RET_OK != rmw_entity_pools_fini()) {
+    st.SkipWithError("rmw_entity_pools_fini failed");
+  }
+}
@@ -0,0 +1,136 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/message_ring_buffer.h"
+#include "rmw/message_sequence.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Capacity of the sequences, as the number of messages handled per take.
+#define BATCH_SIZES Arg(1)->Arg(16)->Arg(256)
+
+// What a subscriber taking in a loop has to do with a plain message sequence.
+BENCHMARK_DEFINE_F(PerformanceTest, message_sequence_init_fini)(benchmark::State & st)
+{
+  const size_t batch_size = static_cast<size_t>(st.range(0));
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_message_sequence_t sequence = rmw_get_zero_initialized_message_sequence();
+    if (RMW_RET_OK != rmw_message_sequence_init(&sequence, batch_size, &allocator)) {
+      st.SkipWithError("rmw_message_sequence_init failed");
+      break;
+    }
+    benchmark::DoNotOptimize(sequence.data);
+    if (RMW_RET_OK != rmw_message_sequence_fini(&sequence)) {
+      st.SkipWithError("rmw_message_sequence_fini failed");
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, message_sequence_init_fini)->BATCH_SIZES;
+
+BENCHMARK_DEFINE_F(PerformanceTest, message_ring_buffer_reset)(benchmark::State & st)
+{
+  const size_t batch_size = static_cast<size_t>(st.range(0));
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_message_ring_buffer_t ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  if (RMW_RET_OK != rmw_message_ring_buffer_init(&ring_buffer, batch_size, &allocator)) {
+    st.SkipWithError("rmw_message_ring_buffer_init failed");
+    return;
+  }
+  reset_heap_counters();
+  for (auto _ : st) {
+    if (RMW_RET_OK != rmw_message_ring_buffer_reset(&ring_buffer)) {
+      st.SkipWithError("rmw_message_ring_buffer_reset failed");
+      break;
+    }
+    benchmark::DoNotOptimize(ring_buffer.data);
+  }
+  if (RMW_RET_OK != rmw_message_ring_buffer_fini(&ring_buffer)) {
+    st.SkipWithError("rmw_message_ring_buffer_fini failed");
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, message_ring_buffer_reset)->BATCH_SIZES;
+
+// Queueing messages and handing them out in order, with a reserved capacity.
+BENCHMARK_DEFINE_F(PerformanceTest, message_ring_buffer_push_pop)(benchmark::State & st)
+{
+  const size_t batch_size = static_cast<size_t>(st.range(0));
+  std::vector<int> messages(batch_size);
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_message_ring_buffer_t ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  if (RMW_RET_OK != rmw_message_ring_buffer_init(&ring_buffer, batch_size, &allocator)) {
+    st.SkipWithError("rmw_message_ring_buffer_init failed");
+    return;
+  }
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (size_t i = 0u; i < batch_size; ++i) {
+      if (RMW_RET_OK != rmw_message_ring_buffer_push(&ring_buffer, &messages[i])) {
+        st.SkipWithError("rmw_message_ring_buffer_push failed");
+        break;
+      }
+    }
+    for (size_t i = 0u; i < batch_size; ++i) {
+      void * message = nullptr;
+      if (RMW_RET_OK != rmw_message_ring_buffer_pop(&ring_buffer, &message)) {
+        st.SkipWithError("rmw_message_ring_buffer_pop failed");
+        break;
+      }
+      benchmark::DoNotOptimize(message);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * batch_size));
+  if (RMW_RET_OK != rmw_message_ring_buffer_fini(&ring_buffer)) {
+    st.SkipWithError("rmw_message_ring_buffer_fini failed");
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, message_ring_buffer_push_pop)->BATCH_SIZES;
+
+// Keeping the last messages in a sliding window, one message per take.
+BENCHMARK_DEFINE_F(PerformanceTest, message_ring_buffer_push_overwrite)(benchmark::State & st)
+{
+  const size_t window_size = static_cast<size_t>(st.range(0));
+  std::vector<int> messages(window_size);
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_message_ring_buffer_t ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  if (RMW_RET_OK != rmw_message_ring_buffer_init(&ring_buffer, window_size, &allocator)) {
+    st.SkipWithError("rmw_message_ring_buffer_init failed");
+    return;
+  }
+  size_t i = 0u;
+  reset_heap_counters();
+  for (auto _ : st) {
+    void * evicted = nullptr;
+    if (RMW_RET_OK !=
+      rmw_message_ring_buffer_push_overwrite(&ring_buffer, &messages[i], &evicted))
+    {
+      st.SkipWithError("rmw_message_ring_buffer_push_overwrite failed");
+      break;
+    }
+    benchmark::DoNotOptimize(evicted);
+    i = (i + 1u) % window_size;
+  }
+  if (RMW_RET_OK != rmw_message_ring_buffer_fini(&ring_buffer)) {
+    st.SkipWithError("rmw_message_ring_buffer_fini failed");
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, message_ring_buffer_push_overwrite)->BATCH_SIZES;
@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/strdup.h"
+#include "rcutils/types/string_array.h"
+
+#include "rmw/names_and_types.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Number of topics, from a small system to a large graph.
+#define TOPIC_COUNTS Arg(100)->Arg(5000)
+
+namespace
+{
+// Topic names and types as a graph query finds them.
+struct Graph
+{
+  explicit Graph(size_t count)
+  : names(count), types(count)
+  {
+    for (size_t i = 0u; i < count; ++i) {
+      names[i] = "/robot_" + std::to_string(i % 16u) + "/sensors/camera_" + std::to_string(i) +
+        "/image_raw";
+      types[i].push_back("sensor_msgs/msg/Image");
+      if (i % 4u == 0u) {
+        types[i].push_back("sensor_msgs/msg/CompressedImage");
+      }
+    }
+  }
+
+  std::vector<std::string> names;
+  std::vector<std::vector<std::string>> types;
+};
+
+// Copy the graph into an initialized array of names and types, as rmw implementations do.
+bool
+populate(const Graph & graph, rmw_names_and_types_t * names_and_types)
+{
+  rcutils_allocator_t allocator = names_and_types->names.allocator;
+  for (size_t i = 0u; i < graph.names.size(); ++i) {
+    names_and_types->names.data[i] = rcutils_strdup(graph.names[i].c_str(), allocator);
+    if (nullptr == names_and_types->names.data[i]) {
+      return false;
+    }
+    if (RCUTILS_RET_OK != rcutils_string_array_init(
+        &names_and_types->types[i], graph.types[i].size(), &allocator))
+    {
+      return false;
+    }
+    for (size_t j = 0u; j < graph.types[i].size(); ++j) {
+      names_and_types->types[i].data[j] = rcutils_strdup(graph.types[i][j].c_str(), allocator);
+      if (nullptr == names_and_types->types[i].data[j]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace
+
+BENCHMARK_DEFINE_F(PerformanceTest, names_and_types_populate_fini)(benchmark::State & st)
+{
+  const Graph graph(static_cast<size_t>(st.range(0)));
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+    if (RMW_RET_OK != rmw_names_and_types_init(&names_and_types, graph.names.size(), &allocator)) {
+      st.SkipWithError("rmw_names_and_types_init failed");
+      break;
+    }
+    const bool populated = populate(graph, &names_and_types);
+    if (RMW_RET_OK != rmw_names_and_types_fini(&names_and_types) || !populated) {
+      st.SkipWithError("populating names and types failed");
+      break;
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, names_and_types_populate_fini)->TOPIC_COUNTS;
+
+BENCHMARK_DEFINE_F(PerformanceTest, names_and_types_populate_fini_arena)(benchmark::State & st)
+{
+  const Graph graph(static_cast<size_t>(st.range(0)));
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  for (auto _ : st) {
+    // Sizing the arena is part of the query
+    size_t types_count = 0u;
+    size_t strings_length = 0u;
+    for (size_t i = 0u; i < graph.names.size(); ++i) {
+      strings_length += graph.names[i].size();
+      types_count += graph.types[i].size();
+      for (const std::string & type : graph.types[i]) {
+        strings_length += type.size();
+      }
+    }
+    size_t arena_size = 0u;
+    rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+    if (
+      RMW_RET_OK != rmw_names_and_types_get_arena_size(
+        graph.names.size(), types_count, strings_length, &arena_size) ||
+      RMW_RET_OK != rmw_names_and_types_init_with_arena(
+        &names_and_types, graph.names.size(), arena_size, &allocator))
+    {
+      st.SkipWithError("rmw_names_and_types_init_with_arena failed");
+      break;
+    }
+    const bool populated = populate(graph, &names_and_types);
+    if (RMW_RET_OK != rmw_names_and_types_fini(&names_and_types) || !populated) {
+      st.SkipWithError("populating names and types failed");
+      break;
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, names_and_types_populate_fini_arena)->TOPIC_COUNTS;
@@ -0,0 +1,81 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/serialized_message.h"
+#include "rmw/serialized_message_pool.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Serialized message sizes, in bytes.
+#define MESSAGE_SIZES Arg(64)->Arg(4096)->Arg(262144)
+
+namespace
+{
+// What a subscriber taking serialized messages in a loop does with each of them.
+void
+take_loop(benchmark::State & st, rcutils_allocator_t * allocator)
+{
+  const size_t message_size = static_cast<size_t>(st.range(0));
+  for (auto _ : st) {
+    rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+    if (RMW_RET_OK != rmw_serialized_message_init(&serialized_message, 0u, allocator)) {
+      st.SkipWithError("rmw_serialized_message_init failed");
+      break;
+    }
+    if (RMW_RET_OK != rmw_serialized_message_resize(&serialized_message, message_size)) {
+      st.SkipWithError("rmw_serialized_message_resize failed");
+      break;
+    }
+    benchmark::DoNotOptimize(serialized_message.buffer);
+    if (RMW_RET_OK != rmw_serialized_message_fini(&serialized_message)) {
+      st.SkipWithError("rmw_serialized_message_fini failed");
+      break;
+    }
+  }
+}
+}  // namespace
+
+BENCHMARK_DEFINE_F(PerformanceTest, serialized_message_default_allocator)(benchmark::State & st)
+{
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  take_loop(st, &allocator);
+}
+BENCHMARK_REGISTER_F(PerformanceTest, serialized_message_default_allocator)->MESSAGE_SIZES;
+
+BENCHMARK_DEFINE_F(PerformanceTest, serialized_message_pool_allocator)(benchmark::State & st)
+{
+  rcutils_allocator_t backing_allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_pool_options_t options =
+    rmw_get_default_serialized_message_pool_options();
+  rmw_serialized_message_pool_t pool = rmw_get_zero_initialized_serialized_message_pool();
+  if (RMW_RET_OK != rmw_serialized_message_pool_init(&pool, &options, &backing_allocator)) {
+    st.SkipWithError("rmw_serialized_message_pool_init failed");
+    return;
+  }
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+  // Warm the pool up, so that only reuse is measured
+  void * block = allocator.allocate(static_cast<size_t>(st.range(0)), allocator.state);
+  allocator.deallocate(block, allocator.state);
+  reset_heap_counters();
+  take_loop(st, &allocator);
+  if (RMW_RET_OK != rmw_serialized_message_pool_fini(&pool)) {
+    st.SkipWithError("rmw_serialized_message_pool_fini failed");
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, serialized_message_pool_allocator)->MESSAGE_SIZES;
@@ -0,0 +1,137 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rmw/topic_endpoint_info_index.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Number of endpoints, from a small system to a large graph.
+#define ENDPOINT_COUNTS Arg(100)->Arg(5000)
+
+namespace
+{
+// Endpoints with GIDs sharing a prefix, as those of a participant do.
+struct Endpoints
+{
+  explicit Endpoints(size_t count)
+  : infos(count, rmw_get_zero_initialized_topic_endpoint_info())
+  {
+    for (size_t i = 0u; i < count; ++i) {
+      memset(infos[i].endpoint_gid, 0x42, RMW_GID_STORAGE_SIZE);
+      memcpy(infos[i].endpoint_gid + RMW_GID_STORAGE_SIZE - sizeof(i), &i, sizeof(i));
+    }
+    array.size = infos.size();
+    array.info_array = infos.data();
+  }
+
+  std::vector<rmw_topic_endpoint_info_t> infos;
+  rmw_topic_endpoint_info_array_t array = rmw_get_zero_initialized_topic_endpoint_info_array();
+};
+}  // namespace
+
+BENCHMARK_DEFINE_F(PerformanceTest, topic_endpoint_info_find_by_gid_scan)(benchmark::State & st)
+{
+  const Endpoints endpoints(static_cast<size_t>(st.range(0)));
+  reset_heap_counters();
+  for (auto _ : st) {
+    // Look every endpoint up, as matching the endpoints of two snapshots does
+    for (const rmw_topic_endpoint_info_t & wanted : endpoints.infos) {
+      const rmw_topic_endpoint_info_t * info = nullptr;
+      for (const rmw_topic_endpoint_info_t & candidate : endpoints.infos) {
+        if (0 == memcmp(candidate.endpoint_gid, wanted.endpoint_gid, RMW_GID_STORAGE_SIZE)) {
+          info = &candidate;
+          break;
+        }
+      }
+      benchmark::DoNotOptimize(info);
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, topic_endpoint_info_find_by_gid_scan)->ENDPOINT_COUNTS;
+
+BENCHMARK_DEFINE_F(PerformanceTest, topic_endpoint_info_find_by_gid_index)(benchmark::State & st)
+{
+  const Endpoints endpoints(static_cast<size_t>(st.range(0)));
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  for (auto _ : st) {
+    // Building the index is part of the lookups
+    rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+    if (RMW_RET_OK != rmw_topic_endpoint_info_index_init(
+        &index, &endpoints.array, false, &allocator))
+    {
+      st.SkipWithError("rmw_topic_endpoint_info_index_init failed");
+      break;
+    }
+    for (const rmw_topic_endpoint_info_t & wanted : endpoints.infos) {
+      const rmw_topic_endpoint_info_t * info = nullptr;
+      if (RMW_RET_OK != rmw_topic_endpoint_info_index_find_by_gid(
+          &index, wanted.endpoint_gid, &info))
+      {
+        st.SkipWithError("rmw_topic_endpoint_info_index_find_by_gid failed");
+        break;
+      }
+      benchmark::DoNotOptimize(info);
+    }
+    if (RMW_RET_OK != rmw_topic_endpoint_info_index_fini(&index)) {
+      st.SkipWithError("rmw_topic_endpoint_info_index_fini failed");
+      break;
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, topic_endpoint_info_find_by_gid_index)->ENDPOINT_COUNTS;
+
+BENCHMARK_DEFINE_F(PerformanceTest, topic_endpoint_info_find_by_node_index)(benchmark::State & st)
+{
+  // All endpoints belong to one node, the worst case for a table keyed by node
+  Endpoints endpoints(static_cast<size_t>(st.range(0)));
+  for (rmw_topic_endpoint_info_t & info : endpoints.infos) {
+    info.node_name = "node";
+    info.node_namespace = "/";
+  }
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  for (auto _ : st) {
+    // Building the index is part of the lookups
+    rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+    if (RMW_RET_OK != rmw_topic_endpoint_info_index_init(
+        &index, &endpoints.array, true, &allocator))
+    {
+      st.SkipWithError("rmw_topic_endpoint_info_index_init failed");
+      break;
+    }
+    const rmw_topic_endpoint_info_t * info = nullptr;
+    do {
+      if (RMW_RET_OK != rmw_topic_endpoint_info_index_find_by_node(
+          &index, "node", "/", info, &info))
+      {
+        st.SkipWithError("rmw_topic_endpoint_info_index_find_by_node failed");
+        break;
+      }
+    } while (nullptr != info);
+    if (RMW_RET_OK != rmw_topic_endpoint_info_index_fini(&index)) {
+      st.SkipWithError("rmw_topic_endpoint_info_index_fini failed");
+      break;
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, topic_endpoint_info_find_by_node_index)->ENDPOINT_COUNTS;
@@ -0,0 +1,160 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/types/string_array.h"
+
+#include "rmw/validate_full_topic_name.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Number of topic names, from a small system to a large graph.
+#define NAME_COUNTS Arg(1024)->Arg(128 * 1024)
+
+// Threads used to validate a single array.
+#define THREAD_COUNT 4u
+
+namespace
+{
+// Topic names as found in a graph, with their storage.
+struct TopicNames
+{
+  explicit TopicNames(size_t count)
+  : storage(count), data(count), names(rcutils_get_zero_initialized_string_array())
+  {
+    for (size_t i = 0u; i < count; ++i) {
+      storage[i] = "/robot_" + std::to_string(i % 16u) + "/sensors/camera_" + std::to_string(i) +
+        "/image_raw";
+      data[i] = &storage[i][0];
+    }
+    names.size = count;
+    names.data = data.data();
+  }
+
+  std::vector<std::string> storage;
+  std::vector<char *> data;
+  rcutils_string_array_t names;
+};
+}  // namespace
+
+// What tools had to do before, a call per name.
+BENCHMARK_DEFINE_F(PerformanceTest, validate_full_topic_name_loop)(benchmark::State & st)
+{
+  TopicNames topic_names(static_cast<size_t>(st.range(0)));
+  std::vector<int> validation_results(topic_names.names.size);
+  std::vector<size_t> invalid_indices(topic_names.names.size);
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (size_t i = 0u; i < topic_names.names.size; ++i) {
+      if (RMW_RET_OK != rmw_validate_full_topic_name(
+          topic_names.names.data[i], &validation_results[i], &invalid_indices[i]))
+      {
+        st.SkipWithError("rmw_validate_full_topic_name failed");
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(validation_results.data());
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, validate_full_topic_name_loop)->NAME_COUNTS;
+
+BENCHMARK_DEFINE_F(PerformanceTest, validate_full_topic_names_batch)(benchmark::State & st)
+{
+  TopicNames topic_names(static_cast<size_t>(st.range(0)));
+  std::vector<int> validation_results(topic_names.names.size);
+  std::vector<size_t> invalid_indices(topic_names.names.size);
+  reset_heap_counters();
+  for (auto _ : st) {
+    if (RMW_RET_OK != rmw_validate_full_topic_names_batch(
+        &topic_names.names, nullptr, validation_results.data(), invalid_indices.data()))
+    {
+      st.SkipWithError("rmw_validate_full_topic_names_batch failed");
+      break;
+    }
+    benchmark::DoNotOptimize(validation_results.data());
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, validate_full_topic_names_batch)->NAME_COUNTS;
+
+// Lengths already known to the caller, as when names come from a graph cache.
+BENCHMARK_DEFINE_F(PerformanceTest, validate_full_topic_names_batch_lengths)(benchmark::State & st)
+{
+  TopicNames topic_names(static_cast<size_t>(st.range(0)));
+  std::vector<size_t> lengths(topic_names.names.size);
+  for (size_t i = 0u; i < topic_names.names.size; ++i) {
+    lengths[i] = topic_names.storage[i].size();
+  }
+  std::vector<int> validation_results(topic_names.names.size);
+  std::vector<size_t> invalid_indices(topic_names.names.size);
+  reset_heap_counters();
+  for (auto _ : st) {
+    if (RMW_RET_OK != rmw_validate_full_topic_names_batch(
+        &topic_names.names, lengths.data(), validation_results.data(), invalid_indices.data()))
+    {
+      st.SkipWithError("rmw_validate_full_topic_names_batch failed");
+      break;
+    }
+    benchmark::DoNotOptimize(validation_results.data());
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, validate_full_topic_names_batch_lengths)->NAME_COUNTS;
+
+// Splitting the array in ranges validated concurrently, thread creation included.
+BENCHMARK_DEFINE_F(PerformanceTest, validate_full_topic_names_batch_threads)(benchmark::State & st)
+{
+  TopicNames topic_names(static_cast<size_t>(st.range(0)));
+  std::vector<int> validation_results(topic_names.names.size);
+  std::vector<size_t> invalid_indices(topic_names.names.size);
+  std::vector<std::thread> threads;
+  threads.reserve(THREAD_COUNT);
+  std::vector<rmw_ret_t> rets(THREAD_COUNT);
+  reset_heap_counters();
+  for (auto _ : st) {
+    const size_t range_size = (topic_names.names.size + THREAD_COUNT - 1u) / THREAD_COUNT;
+    for (size_t t = 0u; t < THREAD_COUNT; ++t) {
+      const size_t begin = std::min(t * range_size, topic_names.names.size);
+      const size_t end = std::min(begin + range_size, topic_names.names.size);
+      threads.emplace_back(
+        [&, t, begin, end]() {
+          rcutils_string_array_t range = topic_names.names;
+          range.size = end - begin;
+          range.data = topic_names.names.data + begin;
+          rets[t] = rmw_validate_full_topic_names_batch(
+            &range, nullptr, validation_results.data() + begin, invalid_indices.data() + begin);
+        });
+    }
+    for (std::thread & thread : threads) {
+      thread.join();
+    }
+    threads.clear();
+    for (rmw_ret_t ret : rets) {
+      if (RMW_RET_OK != ret) {
+        st.SkipWithError("rmw_validate_full_topic_names_batch failed");
+      }
+    }
+    benchmark::DoNotOptimize(validation_results.data());
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTest, validate_full_topic_names_batch_threads)
+->NAME_COUNTS->UseRealTime();
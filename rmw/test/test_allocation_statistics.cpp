@@ -0,0 +1,126 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/allocation_statistics.h"
+#include "rmw/allocators.h"
+#include "rmw/entity_pool.h"
+#include "rmw/error_handling.h"
+
+TEST(test_allocation_statistics, bad_arguments) {
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_get_allocation_statistics(nullptr));
+  rmw_reset_error();
+}
+
+TEST(test_allocation_statistics, disabled) {
+  if (rmw_allocation_statistics_are_enabled()) {
+    GTEST_SKIP() << "rmw was built with allocation statistics";
+  }
+  rmw_allocation_statistics_t statistics;
+  EXPECT_EQ(RMW_RET_UNSUPPORTED, rmw_get_allocation_statistics(&statistics));
+  rmw_reset_error();
+}
+
+TEST(test_allocation_statistics, generic_allocations) {
+  if (!rmw_allocation_statistics_are_enabled()) {
+    GTEST_SKIP() << "rmw was built without allocation statistics";
+  }
+  rmw_allocation_statistics_t before;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_statistics(&before));
+
+  void * small = rmw_allocate(3u);
+  ASSERT_NE(small, nullptr);
+  void * large = rmw_allocate(1000u);
+  ASSERT_NE(large, nullptr);
+
+  rmw_allocation_statistics_t during;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_statistics(&during));
+  const rmw_allocation_site_statistics_t & site_before =
+    before.sites[RMW_ALLOCATION_SITE_GENERIC];
+  const rmw_allocation_site_statistics_t & site_during =
+    during.sites[RMW_ALLOCATION_SITE_GENERIC];
+  EXPECT_EQ(site_during.total_count - site_before.total_count, 2u);
+  EXPECT_EQ(site_during.total_bytes - site_before.total_bytes, 1003u);
+  EXPECT_EQ(site_during.live_count - site_before.live_count, 2u);
+  EXPECT_EQ(site_during.live_bytes - site_before.live_bytes, 1003u);
+  EXPECT_GE(site_during.peak_bytes, site_during.live_bytes);
+  EXPECT_GE(during.peak_bytes, during.live_bytes);
+  // 3 bytes land in [2, 4), 1000 bytes in [512, 1024)
+  EXPECT_EQ(site_during.size_histogram[1] - site_before.size_histogram[1], 1u);
+  EXPECT_EQ(site_during.size_histogram[9] - site_before.size_histogram[9], 1u);
+
+  rmw_free(small);
+  rmw_free(large);
+
+  rmw_allocation_statistics_t after;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_statistics(&after));
+  const rmw_allocation_site_statistics_t & site_after =
+    after.sites[RMW_ALLOCATION_SITE_GENERIC];
+  EXPECT_EQ(site_after.live_count, site_before.live_count);
+  EXPECT_EQ(site_after.live_bytes, site_before.live_bytes);
+  EXPECT_EQ(site_after.peak_bytes, site_during.peak_bytes);
+  EXPECT_EQ(site_after.total_count, site_during.total_count);
+  EXPECT_EQ(after.live_bytes, before.live_bytes);
+}
+
+TEST(test_allocation_statistics, entity_allocations) {
+  if (!rmw_allocation_statistics_are_enabled()) {
+    GTEST_SKIP() << "rmw was built without allocation statistics";
+  }
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  options.capacity[RMW_ENTITY_POOL_SUBSCRIPTION] = 1u;
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_entity_pools_init(&options, &allocator));
+
+  rmw_allocation_statistics_t before;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_statistics(&before));
+
+  // One from the pool, one from the heap; both are accounted for
+  rmw_subscription_t * pooled = rmw_subscription_allocate();
+  ASSERT_NE(pooled, nullptr);
+  rmw_subscription_t * heap = rmw_subscription_allocate();
+  ASSERT_NE(heap, nullptr);
+  rmw_node_t * node = rmw_node_allocate();
+  ASSERT_NE(node, nullptr);
+
+  rmw_allocation_statistics_t during;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_statistics(&during));
+  EXPECT_EQ(
+    during.sites[RMW_ALLOCATION_SITE_SUBSCRIPTION].live_count -
+    before.sites[RMW_ALLOCATION_SITE_SUBSCRIPTION].live_count, 2u);
+  EXPECT_EQ(
+    during.sites[RMW_ALLOCATION_SITE_SUBSCRIPTION].live_bytes -
+    before.sites[RMW_ALLOCATION_SITE_SUBSCRIPTION].live_bytes, 2u * sizeof(rmw_subscription_t));
+  EXPECT_EQ(
+    during.sites[RMW_ALLOCATION_SITE_NODE].live_bytes -
+    before.sites[RMW_ALLOCATION_SITE_NODE].live_bytes, sizeof(rmw_node_t));
+  EXPECT_EQ(
+    during.sites[RMW_ALLOCATION_SITE_GENERIC].total_count,
+    before.sites[RMW_ALLOCATION_SITE_GENERIC].total_count);
+
+  rmw_subscription_free(pooled);
+  rmw_subscription_free(heap);
+  rmw_node_free(node);
+
+  rmw_allocation_statistics_t after;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_statistics(&after));
+  for (size_t i = 0u; i < RMW_ALLOCATION_SITE_COUNT; ++i) {
+    EXPECT_EQ(after.sites[i].live_count, before.sites[i].live_count);
+    EXPECT_EQ(after.sites[i].live_bytes, before.sites[i].live_bytes);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pools_fini());
+}
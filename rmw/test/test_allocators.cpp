@@ -13,7 +13,13 @@
 // limitations under the License.
 
 #include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
 #include "rmw/allocators.h"
+#include "rmw/error_handling.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
 
 TEST(test_rmw_allocators, rmw_allocate_free) {
   void * ptr = rmw_allocate(100u);
@@ -21,6 +27,22 @@ TEST(test_rmw_allocators, rmw_allocate_free) {
   rmw_free(ptr);
 }
 
+TEST(test_rmw_allocators, rmw_allocate_is_zero_initialized) {
+  constexpr size_t size = 1024u * 1024u;
+  unsigned char * ptr = static_cast<unsigned char *>(rmw_allocate(size));
+  ASSERT_NE(ptr, nullptr);
+  for (size_t i = 0u; i < size; ++i) {
+    ASSERT_EQ(ptr[i], 0u) << "at index " << i;
+  }
+  rmw_free(ptr);
+}
+
+TEST(test_rmw_allocators, rmw_allocate_uninitialized_free) {
+  void * ptr = rmw_allocate_uninitialized(100u);
+  EXPECT_NE(ptr, nullptr);
+  rmw_free(ptr);
+}
+
 TEST(test_rmw_allocators, rmw_node_allocate_free) {
   rmw_node_t * node = rmw_node_allocate();
   EXPECT_NE(node, nullptr);
@@ -62,3 +84,52 @@ TEST(test_rmw_allocators, rmw_wait_set_allocate_free) {
   EXPECT_NE(wait_set, nullptr);
   rmw_wait_set_free(wait_set);
 }
+
+TEST(test_rmw_allocators, rmw_set_default_allocator) {
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_set_default_allocator(&invalid_allocator));
+  rmw_reset_error();
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_set_default_allocator(&failing_allocator));
+  rcutils_allocator_t allocator = rmw_get_default_allocator();
+  EXPECT_EQ(allocator.allocate, failing_allocator.allocate);
+  EXPECT_EQ(allocator.state, failing_allocator.state);
+
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(rmw_allocate(100u), nullptr);
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(rmw_allocate_uninitialized(100u), nullptr);
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(rmw_node_allocate(), nullptr);
+
+  ASSERT_EQ(RMW_RET_OK, rmw_set_default_allocator(nullptr));
+  allocator = rmw_get_default_allocator();
+  EXPECT_EQ(allocator.allocate, rcutils_get_default_allocator().allocate);
+  void * ptr = rmw_allocate(100u);
+  EXPECT_NE(ptr, nullptr);
+  rmw_free(ptr);
+}
+
+TEST(test_rmw_allocators, rmw_get_allocation_counts) {
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_get_allocation_counts(nullptr));
+  rmw_reset_error();
+
+  rmw_allocation_counts_t before;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_counts(&before));
+  void * ptr = rmw_allocate(100u);
+  ASSERT_NE(ptr, nullptr);
+  rmw_wait_set_t * wait_set = rmw_wait_set_allocate();
+  ASSERT_NE(wait_set, nullptr);
+  rmw_free(ptr);
+  rmw_free(nullptr);
+
+  rmw_allocation_counts_t after;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_counts(&after));
+  EXPECT_EQ(after.allocations - before.allocations, 2u);
+  EXPECT_EQ(after.deallocations - before.deallocations, 1u);
+
+  rmw_wait_set_free(wait_set);
+  ASSERT_EQ(RMW_RET_OK, rmw_get_allocation_counts(&after));
+  EXPECT_EQ(after.deallocations - before.deallocations, 2u);
+}
@@ -0,0 +1,217 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/contiguous_message_sequence.h"
+#include "rmw/error_handling.h"
+
+namespace
+{
+struct Imu
+{
+  double orientation[4];
+  double angular_velocity[3];
+  double linear_acceleration[3];
+};
+}  // namespace
+
+static bool
+is_aligned(const void * pointer, size_t alignment)
+{
+  return 0u == reinterpret_cast<uintptr_t>(pointer) % alignment;
+}
+
+TEST(test_contiguous_message_sequence, default_initialization) {
+  auto sequence = rmw_get_zero_initialized_contiguous_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_contiguous_message_sequence_init(&sequence, 0u, 8u, &allocator));
+  EXPECT_EQ(0u, sequence.sequence.size);
+  EXPECT_EQ(0u, sequence.sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.sequence.data);
+  EXPECT_EQ(nullptr, sequence.messages);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_contiguous_message_sequence_fini(&sequence));
+  EXPECT_EQ(0u, sequence.sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.messages);
+}
+
+TEST(test_contiguous_message_sequence, initialization_with_size) {
+  auto sequence = rmw_get_zero_initialized_contiguous_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  constexpr size_t capacity = 7u;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_contiguous_message_sequence_init(&sequence, capacity, sizeof(Imu), &allocator));
+  EXPECT_EQ(0u, sequence.sequence.size);
+  EXPECT_EQ(capacity, sequence.sequence.capacity);
+  EXPECT_EQ(sizeof(Imu), sequence.message_size);
+  EXPECT_GE(sequence.message_stride, sizeof(Imu));
+  EXPECT_TRUE(is_aligned(sequence.messages, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+
+  // Entries point into the slab, one stride apart, each usable as a message
+  const uint8_t * slab = static_cast<const uint8_t *>(sequence.messages);
+  for (size_t i = 0u; i < capacity; ++i) {
+    EXPECT_EQ(slab + i * sequence.message_stride, sequence.sequence.data[i]);
+    EXPECT_TRUE(is_aligned(sequence.sequence.data[i], alignof(Imu)));
+    Imu * imu = static_cast<Imu *>(sequence.sequence.data[i]);
+    EXPECT_EQ(0.0, imu->orientation[0]);
+    imu->linear_acceleration[2] = static_cast<double>(i);
+  }
+  for (size_t i = 0u; i < capacity; ++i) {
+    const Imu * imu = reinterpret_cast<const Imu *>(slab + i * sequence.message_stride);
+    EXPECT_EQ(static_cast<double>(i), imu->linear_acceleration[2]);
+  }
+
+  EXPECT_EQ(RMW_RET_OK, rmw_contiguous_message_sequence_fini(&sequence));
+  EXPECT_EQ(0u, sequence.sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.sequence.data);
+  EXPECT_EQ(nullptr, sequence.messages);
+  EXPECT_EQ(nullptr, sequence.storage);
+}
+
+TEST(test_contiguous_message_sequence, bad_arguments) {
+  auto sequence = rmw_get_zero_initialized_contiguous_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_contiguous_message_sequence_init(nullptr, 5u, 8u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_contiguous_message_sequence_init(&sequence, 5u, 0u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_contiguous_message_sequence_init(&sequence, 5u, 8u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_contiguous_message_sequence_init(&sequence, SIZE_MAX / 2u, 8u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, sequence.storage);
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_contiguous_message_sequence_init(&sequence, 5u, 8u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, sequence.storage);
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_contiguous_message_sequence_fini(nullptr));
+  rmw_reset_error();
+}
+
+TEST(test_message_info_soa_sequence, default_initialization) {
+  auto sequence = rmw_get_zero_initialized_message_info_soa_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_init(&sequence, 0u, &allocator));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(0u, sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.source_timestamps);
+  EXPECT_EQ(nullptr, sequence.publisher_gids);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_fini(&sequence));
+  EXPECT_EQ(0u, sequence.capacity);
+}
+
+TEST(test_message_info_soa_sequence, copy_from) {
+  auto allocator = rcutils_get_default_allocator();
+  auto info_sequence = rmw_get_zero_initialized_message_info_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&info_sequence, 3u, &allocator));
+  for (size_t i = 0u; i < 3u; ++i) {
+    rmw_message_info_t & info = info_sequence.data[i];
+    info = rmw_get_zero_initialized_message_info();
+    info.source_timestamp = static_cast<rmw_time_point_value_t>(100 + i);
+    info.received_timestamp = static_cast<rmw_time_point_value_t>(200 + i);
+    info.publication_sequence_number = 300u + i;
+    info.reception_sequence_number = 400u + i;
+    info.publisher_gid.data[0] = static_cast<uint8_t>(i);
+    info.from_intra_process = (i % 2u) == 0u;
+  }
+  info_sequence.size = 3u;
+
+  auto soa_sequence = rmw_get_zero_initialized_message_info_soa_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_init(&soa_sequence, 3u, &allocator));
+  EXPECT_EQ(3u, soa_sequence.capacity);
+  EXPECT_TRUE(is_aligned(soa_sequence.source_timestamps, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+  EXPECT_TRUE(is_aligned(soa_sequence.received_timestamps, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+  EXPECT_TRUE(
+    is_aligned(soa_sequence.publication_sequence_numbers, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+  EXPECT_TRUE(
+    is_aligned(soa_sequence.reception_sequence_numbers, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+  EXPECT_TRUE(is_aligned(soa_sequence.publisher_gids, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+  EXPECT_TRUE(is_aligned(soa_sequence.from_intra_process, RMW_CONTIGUOUS_SEQUENCE_ALIGNMENT));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_copy_from(&info_sequence, &soa_sequence));
+  EXPECT_EQ(3u, soa_sequence.size);
+  for (size_t i = 0u; i < 3u; ++i) {
+    EXPECT_EQ(static_cast<rmw_time_point_value_t>(100 + i), soa_sequence.source_timestamps[i]);
+    EXPECT_EQ(static_cast<rmw_time_point_value_t>(200 + i), soa_sequence.received_timestamps[i]);
+    EXPECT_EQ(300u + i, soa_sequence.publication_sequence_numbers[i]);
+    EXPECT_EQ(400u + i, soa_sequence.reception_sequence_numbers[i]);
+    EXPECT_EQ(static_cast<uint8_t>(i), soa_sequence.publisher_gids[i].data[0]);
+    EXPECT_EQ((i % 2u) == 0u, soa_sequence.from_intra_process[i]);
+  }
+
+  // Too small a destination is rejected, leaving it untouched
+  auto small_sequence = rmw_get_zero_initialized_message_info_soa_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_init(&small_sequence, 2u, &allocator));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_message_info_soa_sequence_copy_from(&info_sequence, &small_sequence));
+  rmw_reset_error();
+  EXPECT_EQ(0u, small_sequence.size);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_fini(&small_sequence));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_soa_sequence_fini(&soa_sequence));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&info_sequence));
+}
+
+TEST(test_message_info_soa_sequence, bad_arguments) {
+  auto sequence = rmw_get_zero_initialized_message_info_soa_sequence();
+  auto info_sequence = rmw_get_zero_initialized_message_info_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_soa_sequence_init(nullptr, 5u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_soa_sequence_init(&sequence, 5u, nullptr));
+  rmw_reset_error();
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_message_info_soa_sequence_init(&sequence, 5u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, sequence.storage);
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_message_info_soa_sequence_copy_from(nullptr, &sequence));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_message_info_soa_sequence_copy_from(&info_sequence, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_soa_sequence_fini(nullptr));
+  rmw_reset_error();
+}
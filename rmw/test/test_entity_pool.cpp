@@ -0,0 +1,178 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <set>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/allocators.h"
+#include "rmw/entity_pool.h"
+#include "rmw/error_handling.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+
+static size_t
+get_in_use(rmw_entity_pool_type_t type)
+{
+  size_t in_use = 0u;
+  size_t capacity = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pool_get_usage(type, &in_use, &capacity));
+  return in_use;
+}
+
+TEST(test_entity_pool, get_zero_initialized_options) {
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  for (size_t i = 0u; i < RMW_ENTITY_POOL_TYPE_COUNT; ++i) {
+    EXPECT_EQ(options.capacity[i], 0u);
+  }
+}
+
+TEST(test_entity_pool, bad_arguments) {
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_entity_pools_init(nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_entity_pools_init(&options, nullptr));
+  rmw_reset_error();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_entity_pools_init(&options, &invalid_allocator));
+  rmw_reset_error();
+
+  size_t in_use = 0u;
+  size_t capacity = 0u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_entity_pool_get_usage(RMW_ENTITY_POOL_TYPE_COUNT, &in_use, &capacity));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_entity_pool_get_usage(RMW_ENTITY_POOL_NODE, nullptr, &capacity));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_entity_pool_get_usage(RMW_ENTITY_POOL_NODE, &in_use, nullptr));
+  rmw_reset_error();
+}
+
+TEST(test_entity_pool, disabled_pools_use_heap) {
+  rmw_publisher_t * publisher = rmw_publisher_allocate();
+  ASSERT_NE(publisher, nullptr);
+  EXPECT_EQ(get_in_use(RMW_ENTITY_POOL_PUBLISHER), 0u);
+  rmw_publisher_free(publisher);
+}
+
+TEST(test_entity_pool, allocate_from_pool_then_fall_back_to_heap) {
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  options.capacity[RMW_ENTITY_POOL_PUBLISHER] = 4u;
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_entity_pools_init(&options, &allocator));
+
+  size_t in_use = 0u;
+  size_t capacity = 0u;
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_entity_pool_get_usage(RMW_ENTITY_POOL_PUBLISHER, &in_use, &capacity));
+  EXPECT_EQ(in_use, 0u);
+  EXPECT_EQ(capacity, 4u);
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_entity_pool_get_usage(RMW_ENTITY_POOL_NODE, &in_use, &capacity));
+  EXPECT_EQ(capacity, 0u);
+
+  std::vector<rmw_publisher_t *> publishers;
+  for (size_t i = 0u; i < 6u; ++i) {
+    rmw_publisher_t * publisher = rmw_publisher_allocate();
+    ASSERT_NE(publisher, nullptr);
+    EXPECT_EQ(publisher->implementation_identifier, nullptr);
+    EXPECT_EQ(publisher->data, nullptr);
+    EXPECT_EQ(publisher->topic_name, nullptr);
+    // Dirty the block so that reuse must zero it again
+    publisher->data = publisher;
+    publishers.push_back(publisher);
+  }
+  EXPECT_EQ(get_in_use(RMW_ENTITY_POOL_PUBLISHER), 4u);
+  // Pooled blocks are contiguous and handed out in address order
+  for (size_t i = 1u; i < 4u; ++i) {
+    EXPECT_GT(publishers[i], publishers[i - 1u]);
+  }
+  EXPECT_EQ(
+    std::set<rmw_publisher_t *>(publishers.begin(), publishers.end()).size(), publishers.size());
+
+  // Cannot release a pool with entities still living in it
+  EXPECT_EQ(RMW_RET_ERROR, rmw_entity_pools_fini());
+  rmw_reset_error();
+
+  for (rmw_publisher_t * publisher : publishers) {
+    rmw_publisher_free(publisher);
+  }
+  EXPECT_EQ(get_in_use(RMW_ENTITY_POOL_PUBLISHER), 0u);
+
+  rmw_publisher_t * publisher = rmw_publisher_allocate();
+  ASSERT_NE(publisher, nullptr);
+  EXPECT_EQ(publisher->data, nullptr);
+  EXPECT_EQ(get_in_use(RMW_ENTITY_POOL_PUBLISHER), 1u);
+  rmw_publisher_free(publisher);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pools_fini());
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_entity_pool_get_usage(RMW_ENTITY_POOL_PUBLISHER, &in_use, &capacity));
+  EXPECT_EQ(capacity, 0u);
+}
+
+TEST(test_entity_pool, pools_are_reference_counted) {
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  options.capacity[RMW_ENTITY_POOL_NODE] = 2u;
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_entity_pools_init(&options, &allocator));
+  options.capacity[RMW_ENTITY_POOL_NODE] = 8u;
+  ASSERT_EQ(RMW_RET_OK, rmw_entity_pools_init(&options, &allocator));
+
+  size_t in_use = 0u;
+  size_t capacity = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pool_get_usage(RMW_ENTITY_POOL_NODE, &in_use, &capacity));
+  EXPECT_EQ(capacity, 2u);
+
+  rmw_node_t * node = rmw_node_allocate();
+  ASSERT_NE(node, nullptr);
+  // Another reference is still held, so this one can be dropped
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pools_fini());
+  EXPECT_EQ(get_in_use(RMW_ENTITY_POOL_NODE), 1u);
+  rmw_node_free(node);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pools_fini());
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pool_get_usage(RMW_ENTITY_POOL_NODE, &in_use, &capacity));
+  EXPECT_EQ(capacity, 0u);
+  // Releasing more references than taken is harmless
+  EXPECT_EQ(RMW_RET_OK, rmw_entity_pools_fini());
+}
+
+TEST(test_entity_pool, failing_allocator_leaves_pools_disabled) {
+  rmw_entity_pool_options_t options = rmw_get_zero_initialized_entity_pool_options();
+  options.capacity[RMW_ENTITY_POOL_NODE] = 2u;
+  options.capacity[RMW_ENTITY_POOL_WAIT_SET] = 2u;
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 1);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_entity_pools_init(&options, &failing_allocator));
+  rmw_reset_error();
+
+  for (size_t i = 0u; i < RMW_ENTITY_POOL_TYPE_COUNT; ++i) {
+    size_t in_use = 0u;
+    size_t capacity = 0u;
+    EXPECT_EQ(
+      RMW_RET_OK,
+      rmw_entity_pool_get_usage(static_cast<rmw_entity_pool_type_t>(i), &in_use, &capacity));
+    EXPECT_EQ(capacity, 0u);
+  }
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/graph_events.h"
+
+TEST(test_graph_events, get_zero_initialized_graph_event_array) {
+  const rmw_graph_event_array_t events = rmw_get_zero_initialized_graph_event_array();
+  EXPECT_EQ(0u, events.size);
+  EXPECT_EQ(nullptr, events.events);
+  EXPECT_EQ(0u, events.generation);
+  EXPECT_FALSE(events.history_truncated);
+}
+
+TEST(test_graph_events, check_zero) {
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_graph_event_array_check_zero(nullptr));
+  rmw_reset_error();
+
+  rmw_graph_event_array_t events = rmw_get_zero_initialized_graph_event_array();
+  EXPECT_EQ(RMW_RET_OK, rmw_graph_event_array_check_zero(&events));
+  events.generation = 42u;
+  EXPECT_EQ(RMW_RET_ERROR, rmw_graph_event_array_check_zero(&events));
+  rmw_reset_error();
+  events = rmw_get_zero_initialized_graph_event_array();
+  events.history_truncated = true;
+  EXPECT_EQ(RMW_RET_ERROR, rmw_graph_event_array_check_zero(&events));
+  rmw_reset_error();
+  events = rmw_get_zero_initialized_graph_event_array();
+  events.size = 1u;
+  EXPECT_EQ(RMW_RET_ERROR, rmw_graph_event_array_check_zero(&events));
+  rmw_reset_error();
+}
+
+TEST(test_graph_events, init_fini) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_graph_event_array_t events = rmw_get_zero_initialized_graph_event_array();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_graph_event_array_init_with_size(nullptr, 1u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_graph_event_array_init_with_size(&events, 1u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_graph_event_array_init_with_size(&events, SIZE_MAX, &allocator));
+  rmw_reset_error();
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_graph_event_array_init_with_size(&events, 1u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_graph_event_array_check_zero(&events));
+
+  ASSERT_EQ(RMW_RET_OK, rmw_graph_event_array_init_with_size(&events, 3u, &allocator));
+  ASSERT_EQ(3u, events.size);
+  ASSERT_NE(nullptr, events.events);
+  for (size_t i = 0u; i < events.size; ++i) {
+    EXPECT_EQ(0u, events.events[i].generation);
+    EXPECT_EQ(RMW_GRAPH_EVENT_INVALID, events.events[i].kind);
+    EXPECT_EQ(RMW_ENDPOINT_INVALID, events.events[i].endpoint_type);
+    EXPECT_EQ(nullptr, events.events[i].node_name);
+    EXPECT_EQ(nullptr, events.events[i].node_namespace);
+    EXPECT_EQ(nullptr, events.events[i].name);
+    EXPECT_EQ(nullptr, events.events[i].type);
+    for (size_t j = 0u; j < RMW_GID_STORAGE_SIZE; ++j) {
+      EXPECT_EQ(0u, events.events[i].endpoint_gid[j]);
+    }
+  }
+  // Only zero initialized arrays may be initialized
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_graph_event_array_init_with_size(&events, 1u, &allocator));
+  rmw_reset_error();
+
+  // Event strings belong to the rmw implementation
+  events.events[0].kind = RMW_GRAPH_EVENT_NODE_ADDED;
+  events.events[0].node_name = "talker";
+  events.events[0].node_namespace = "/";
+  events.generation = 1u;
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_graph_event_array_fini(nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_graph_event_array_fini(&events, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_graph_event_array_fini(&events, &allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_graph_event_array_check_zero(&events));
+
+  // Empty arrays are fine
+  ASSERT_EQ(RMW_RET_OK, rmw_graph_event_array_init_with_size(&events, 0u, &allocator));
+  EXPECT_EQ(0u, events.size);
+  EXPECT_EQ(RMW_RET_OK, rmw_graph_event_array_fini(&events, &allocator));
+}
@@ -22,3 +22,11 @@ TEST(rmw_init_options, get_zero_initialized_init_options)
   EXPECT_EQ(options.implementation_identifier, nullptr);
   EXPECT_EQ(options.impl, nullptr);
 }
+
+TEST(rmw_init_options, zero_initialized_init_options_disable_entity_pools)
+{
+  const rmw_init_options_t options = rmw_get_zero_initialized_init_options();
+  for (size_t i = 0u; i < RMW_ENTITY_POOL_TYPE_COUNT; ++i) {
+    EXPECT_EQ(options.entity_pool_options.capacity[i], 0u);
+  }
+}
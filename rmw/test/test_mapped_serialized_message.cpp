@@ -0,0 +1,273 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "gmock/gmock.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/mapped_serialized_message.h"
+
+#ifdef _WIN32
+TEST(test_mapped_serialized_message, unsupported) {
+  auto allocator = rcutils_get_default_allocator();
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+  EXPECT_EQ(
+    RMW_RET_UNSUPPORTED, rmw_mapped_serialized_message_init(&mapped, nullptr, 16u, &allocator));
+  rmw_reset_error();
+}
+#else
+TEST(test_mapped_serialized_message, anonymous_file_shared_by_fd) {
+  auto allocator = rcutils_get_default_allocator();
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_init(&mapped, nullptr, 16u, &allocator));
+  rmw_serialized_message_t * serialized_message = &mapped.serialized_message;
+  ASSERT_NE(nullptr, serialized_message->buffer);
+  EXPECT_EQ(16u, serialized_message->buffer_capacity);
+  memcpy(serialized_message->buffer, "payload", 7u);
+  serialized_message->buffer_length = 7u;
+
+  int fd = -1;
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_get_fd(&mapped, &fd));
+  EXPECT_LE(0, fd);
+
+  // The receiving side maps the same bytes
+  auto received = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_mapped_serialized_message_init_from_fd(&received, fd, 7u, &allocator));
+  EXPECT_NE(serialized_message->buffer, received.serialized_message.buffer);
+  EXPECT_EQ(7u, received.serialized_message.buffer_length);
+  EXPECT_EQ(0, memcmp("payload", received.serialized_message.buffer, 7u));
+  received.serialized_message.buffer[0] = 'P';
+  EXPECT_EQ('P', serialized_message->buffer[0]);
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&received));
+  EXPECT_EQ(nullptr, received.impl);
+
+  // Resizing keeps the contents
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(serialized_message, 1u << 20u));
+  EXPECT_EQ(static_cast<size_t>(1u << 20u), serialized_message->buffer_capacity);
+  EXPECT_EQ(0, memcmp("Payload", serialized_message->buffer, 7u));
+  serialized_message->buffer[(1u << 20u) - 1u] = 42u;
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(serialized_message, 8u));
+  EXPECT_EQ(0, memcmp("Payload", serialized_message->buffer, 7u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&mapped));
+  EXPECT_EQ(nullptr, mapped.impl);
+  EXPECT_EQ(nullptr, mapped.serialized_message.buffer);
+  // Finalizing a zero initialized mapped serialized message does nothing
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&mapped));
+}
+
+TEST(test_mapped_serialized_message, file_written_in_place) {
+  const std::filesystem::path path =
+    std::filesystem::temp_directory_path() / "test_mapped_serialized_message.bin";
+  auto allocator = rcutils_get_default_allocator();
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_mapped_serialized_message_init(&mapped, path.string().c_str(), 0u, &allocator));
+  EXPECT_EQ(nullptr, mapped.serialized_message.buffer);
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&mapped.serialized_message, 5u));
+  memcpy(mapped.serialized_message.buffer, "bytes", 5u);
+  mapped.serialized_message.buffer_length = 5u;
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&mapped));
+
+  std::ifstream file(path, std::ios::binary);
+  std::string contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  EXPECT_EQ("bytes", contents);
+  file.close();
+  std::filesystem::remove(path);
+}
+
+TEST(test_mapped_serialized_message, received_fd_not_resized) {
+  auto allocator = rcutils_get_default_allocator();
+  auto sent = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_init(&sent, nullptr, 16u, &allocator));
+  memcpy(sent.serialized_message.buffer, "payload and more", 16u);
+  int fd = -1;
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_get_fd(&sent, &fd));
+
+  // The sending process still has the whole file mapped, only a prefix is received
+  auto received = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_mapped_serialized_message_init_from_fd(&received, fd, 7u, &allocator));
+  EXPECT_NE(RCUTILS_RET_OK, rmw_serialized_message_resize(&received.serialized_message, 4u));
+  rmw_reset_error();
+  EXPECT_NE(RCUTILS_RET_OK, rmw_serialized_message_resize(&received.serialized_message, 64u));
+  rmw_reset_error();
+  EXPECT_EQ(7u, received.serialized_message.buffer_capacity);
+  EXPECT_EQ(0, memcmp("payload", received.serialized_message.buffer, 7u));
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&received));
+
+  // Nor is an empty payload given a buffer
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_mapped_serialized_message_init_from_fd(&received, fd, 0u, &allocator));
+  EXPECT_NE(RCUTILS_RET_OK, rmw_serialized_message_resize(&received.serialized_message, 4u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&received));
+
+  struct stat file_status;
+  ASSERT_EQ(0, fstat(fd, &file_status));
+  EXPECT_EQ(16, file_status.st_size);
+  EXPECT_EQ(0, memcmp("payload and more", sent.serialized_message.buffer, 16u));
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&sent));
+}
+
+TEST(test_mapped_serialized_message, read_only_fd) {
+  const std::filesystem::path path =
+    std::filesystem::temp_directory_path() / "test_mapped_serialized_message_read_only.bin";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "bytes";
+  }
+  auto allocator = rcutils_get_default_allocator();
+
+  // The receiving side may only have read access to the payload
+  int fd = open(path.string().c_str(), O_RDONLY | O_CLOEXEC);
+  ASSERT_LE(0, fd);
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_init_from_fd(&mapped, fd, 5u, &allocator));
+  EXPECT_EQ(0, close(fd));
+  EXPECT_EQ(5u, mapped.serialized_message.buffer_length);
+  EXPECT_EQ(0, memcmp("bytes", mapped.serialized_message.buffer, 5u));
+  EXPECT_NE(RCUTILS_RET_OK, rmw_serialized_message_resize(&mapped.serialized_message, 8u));
+  rmw_reset_error();
+  EXPECT_EQ(0, memcmp("bytes", mapped.serialized_message.buffer, 5u));
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&mapped));
+
+  // Mapping needs read access
+  fd = open(path.string().c_str(), O_WRONLY | O_CLOEXEC);
+  ASSERT_LE(0, fd);
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init_from_fd(&mapped, fd, 5u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, mapped.impl);
+  EXPECT_EQ(0, close(fd));
+
+  std::filesystem::remove(path);
+}
+
+TEST(test_mapped_serialized_message, allocator_adapter) {
+  auto allocator = rcutils_get_default_allocator();
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_init(&mapped, nullptr, 0u, &allocator));
+  rcutils_allocator_t mapped_allocator = rmw_mapped_serialized_message_get_allocator(&mapped);
+  ASSERT_TRUE(rcutils_allocator_is_valid(&mapped_allocator));
+
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 32u, &mapped_allocator));
+  memset(serialized_message.buffer, 0xff, 32u);
+  // The file holds a single buffer
+  EXPECT_EQ(nullptr, mapped_allocator.allocate(8u, mapped_allocator.state));
+  uint8_t other = 0u;
+  EXPECT_EQ(nullptr, mapped_allocator.reallocate(&other, 8u, mapped_allocator.state));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+
+  // Available again, and cleared when zero allocated
+  auto bytes = static_cast<uint8_t *>(
+    mapped_allocator.zero_allocate(4u, 8u, mapped_allocator.state));
+  ASSERT_NE(nullptr, bytes);
+  for (size_t i = 0u; i < 32u; ++i) {
+    EXPECT_EQ(0u, bytes[i]);
+  }
+  mapped_allocator.deallocate(bytes, mapped_allocator.state);
+  EXPECT_EQ(
+    nullptr, mapped_allocator.zero_allocate(SIZE_MAX, 2u, mapped_allocator.state));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&mapped));
+  mapped_allocator = rmw_mapped_serialized_message_get_allocator(&mapped);
+  EXPECT_FALSE(rcutils_allocator_is_valid(&mapped_allocator));
+}
+
+TEST(test_mapped_serialized_message, bad_arguments) {
+  auto allocator = rcutils_get_default_allocator();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+  int fd = -1;
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init(nullptr, nullptr, 0u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init(&mapped, nullptr, 0u, &invalid_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_ERROR,
+    rmw_mapped_serialized_message_init(&mapped, "/nonexistent/directory/file", 0u, &allocator));
+  rmw_reset_error();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init_from_fd(nullptr, 0, 0u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init_from_fd(&mapped, -1, 0u, &allocator));
+  rmw_reset_error();
+
+  auto source = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_init(&source, nullptr, 8u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_get_fd(&source, &fd));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init_from_fd(&mapped, fd, 8u, &invalid_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_init_from_fd(&mapped, fd, 9u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, mapped.impl);
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&source));
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_fini(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_get_fd(nullptr, &fd));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_get_fd(&mapped, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_get_fd(&mapped, &fd));
+  rmw_reset_error();
+  rcutils_allocator_t mapped_allocator = rmw_mapped_serialized_message_get_allocator(nullptr);
+  EXPECT_FALSE(rcutils_allocator_is_valid(&mapped_allocator));
+}
+
+TEST(test_mapped_serialized_message, failed_allocation) {
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  auto mapped = rmw_get_zero_initialized_mapped_serialized_message();
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_mapped_serialized_message_init(&mapped, nullptr, 8u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, mapped.impl);
+}
+#endif
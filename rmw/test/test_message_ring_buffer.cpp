@@ -0,0 +1,270 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/message_ring_buffer.h"
+
+TEST(test_message_ring_buffer, default_initialization) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 0u, &allocator));
+  EXPECT_EQ(0u, ring_buffer.size);
+  EXPECT_EQ(0u, ring_buffer.capacity);
+  EXPECT_EQ(nullptr, ring_buffer.data);
+  EXPECT_EQ(nullptr, rmw_message_ring_buffer_at(&ring_buffer, 0u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+  EXPECT_EQ(0u, ring_buffer.capacity);
+  EXPECT_EQ(nullptr, ring_buffer.allocator);
+}
+
+TEST(test_message_ring_buffer, push_pop_fifo) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  auto allocator = rcutils_get_default_allocator();
+  int messages[8];
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 4u, &allocator));
+  EXPECT_EQ(4u, ring_buffer.capacity);
+  EXPECT_EQ(4u, ring_buffer.reserved);
+
+  // Interleave pushes and pops so that entries wrap around the end of the array
+  void * message = nullptr;
+  for (size_t i = 0u; i < 3u; ++i) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[i]));
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+  EXPECT_EQ(&messages[0], message);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+  EXPECT_EQ(&messages[1], message);
+  for (size_t i = 3u; i < 6u; ++i) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[i]));
+  }
+  EXPECT_EQ(4u, ring_buffer.size);
+  EXPECT_EQ(4u, ring_buffer.capacity);
+  EXPECT_NE(0u, ring_buffer.head);
+  for (size_t i = 0u; i < 4u; ++i) {
+    EXPECT_EQ(&messages[i + 2u], rmw_message_ring_buffer_at(&ring_buffer, i));
+  }
+  EXPECT_EQ(nullptr, rmw_message_ring_buffer_at(&ring_buffer, 4u));
+
+  // Growing while wrapped keeps the order
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[6]));
+  EXPECT_EQ(8u, ring_buffer.capacity);
+  for (size_t i = 2u; i < 7u; ++i) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+    EXPECT_EQ(&messages[i], message);
+  }
+  EXPECT_EQ(0u, ring_buffer.size);
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+}
+
+TEST(test_message_ring_buffer, reset_keeps_capacity) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  auto allocator = rcutils_get_default_allocator();
+  int messages[3];
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 3u, &allocator));
+  void ** data = ring_buffer.data;
+  for (int & message : messages) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &message));
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_reset(&ring_buffer));
+  EXPECT_EQ(0u, ring_buffer.size);
+  EXPECT_EQ(3u, ring_buffer.capacity);
+  EXPECT_EQ(data, ring_buffer.data);
+  EXPECT_EQ(nullptr, rmw_message_ring_buffer_at(&ring_buffer, 0u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[2]));
+  EXPECT_EQ(&messages[2], rmw_message_ring_buffer_at(&ring_buffer, 0u));
+  EXPECT_EQ(data, ring_buffer.data);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+}
+
+TEST(test_message_ring_buffer, push_overwrite_sliding_window) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  auto allocator = rcutils_get_default_allocator();
+  int messages[10];
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 3u, &allocator));
+  void ** data = ring_buffer.data;
+  for (size_t i = 0u; i < 10u; ++i) {
+    void * evicted = &messages[0];
+    EXPECT_EQ(
+      RMW_RET_OK, rmw_message_ring_buffer_push_overwrite(&ring_buffer, &messages[i], &evicted));
+    if (i < 3u) {
+      EXPECT_EQ(nullptr, evicted);
+    } else {
+      EXPECT_EQ(&messages[i - 3u], evicted);
+    }
+    // The window always holds the last three messages, oldest first
+    const size_t window = i < 3u ? i + 1u : 3u;
+    EXPECT_EQ(window, ring_buffer.size);
+    for (size_t j = 0u; j < window; ++j) {
+      EXPECT_EQ(&messages[i + 1u - window + j], rmw_message_ring_buffer_at(&ring_buffer, j));
+    }
+  }
+  EXPECT_EQ(3u, ring_buffer.capacity);
+  EXPECT_EQ(data, ring_buffer.data);
+
+  // Evicted messages may be discarded
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push_overwrite(&ring_buffer, nullptr, nullptr));
+  EXPECT_EQ(nullptr, rmw_message_ring_buffer_at(&ring_buffer, 2u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+}
+
+TEST(test_message_ring_buffer, grow_and_shrink) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  auto allocator = rcutils_get_default_allocator();
+  int messages[64];
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 2u, &allocator));
+  for (int & message : messages) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &message));
+  }
+  EXPECT_EQ(64u, ring_buffer.size);
+  EXPECT_EQ(64u, ring_buffer.capacity);
+
+  // Capacity halves once no more than a quarter of it is used, down to the reserved capacity
+  void * message = nullptr;
+  for (size_t i = 0u; i < 48u; ++i) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+    EXPECT_EQ(&messages[i], message);
+  }
+  EXPECT_EQ(16u, ring_buffer.size);
+  EXPECT_EQ(32u, ring_buffer.capacity);
+  for (size_t i = 48u; i < 64u; ++i) {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+    EXPECT_EQ(&messages[i], message);
+  }
+  EXPECT_EQ(2u, ring_buffer.capacity);
+
+  // Reserving raises the floor
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_reserve(&ring_buffer, 16u));
+  EXPECT_EQ(16u, ring_buffer.capacity);
+  EXPECT_EQ(16u, ring_buffer.reserved);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[0]));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+  EXPECT_EQ(16u, ring_buffer.capacity);
+
+  // Reserving less than the capacity is a no-op
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_reserve(&ring_buffer, 4u));
+  EXPECT_EQ(16u, ring_buffer.capacity);
+  EXPECT_EQ(16u, ring_buffer.reserved);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+}
+
+TEST(test_message_ring_buffer, bad_arguments) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  auto allocator = rcutils_get_default_allocator();
+  int message = 0;
+  void * popped = nullptr;
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_init(nullptr, 2u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_init(&ring_buffer, 2u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_ring_buffer_init(&ring_buffer, SIZE_MAX, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, ring_buffer.data);
+
+  // A zero initialized ring buffer has no allocator to grow with
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_push(&ring_buffer, &message));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_reserve(&ring_buffer, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_message_ring_buffer_push_overwrite(&ring_buffer, &message, nullptr));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_fini(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_reset(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_reserve(nullptr, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_push(nullptr, &message));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_push_overwrite(nullptr, &message, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_pop(nullptr, &popped));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, rmw_message_ring_buffer_at(nullptr, 0u));
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 1u, &allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &message));
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_ring_buffer_pop(&ring_buffer, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+}
+
+TEST(test_message_ring_buffer, failed_allocations) {
+  auto ring_buffer = rmw_get_zero_initialized_message_ring_buffer();
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  int messages[3];
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_message_ring_buffer_init(&ring_buffer, 2u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, ring_buffer.data);
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_ring_buffer_init(&ring_buffer, 2u, &failing_allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[0]));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[1]));
+
+  // A failed grow leaves the ring buffer untouched
+  void ** data = ring_buffer.data;
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_ring_buffer_push(&ring_buffer, &messages[2]));
+  rmw_reset_error();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_ring_buffer_reserve(&ring_buffer, 8u));
+  rmw_reset_error();
+  EXPECT_EQ(data, ring_buffer.data);
+  EXPECT_EQ(2u, ring_buffer.size);
+  EXPECT_EQ(2u, ring_buffer.capacity);
+  EXPECT_EQ(2u, ring_buffer.reserved);
+  EXPECT_EQ(&messages[0], rmw_message_ring_buffer_at(&ring_buffer, 0u));
+  EXPECT_EQ(&messages[1], rmw_message_ring_buffer_at(&ring_buffer, 1u));
+
+  // A failed shrink is not an error
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_push(&ring_buffer, &messages[2]));
+  EXPECT_EQ(4u, ring_buffer.capacity);
+  void * message = nullptr;
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_pop(&ring_buffer, &message));
+  EXPECT_FALSE(rmw_error_is_set());
+  EXPECT_EQ(&messages[1], message);
+  EXPECT_EQ(4u, ring_buffer.capacity);
+  EXPECT_EQ(&messages[2], rmw_message_ring_buffer_at(&ring_buffer, 0u));
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_ring_buffer_fini(&ring_buffer));
+}
@@ -12,11 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 
 #include "./time_bomb_allocator_testing_utils.h"
 #include "rcutils/error_handling.h"
+#include "rcutils/strdup.h"
+#include "rcutils/types/string_array.h"
 #include "rmw/error_handling.h"
 #include "rmw/names_and_types.h"
 
@@ -173,3 +179,184 @@ TEST(rmw_names_and_types, rmw_names_and_types_fini) {
   names_and_types.types[0].allocator = allocator;
   EXPECT_EQ(rmw_names_and_types_fini(&names_and_types), RMW_RET_OK);
 }
+
+TEST(rmw_names_and_types, rmw_names_and_types_get_arena_size) {
+  size_t arena_size = 0u;
+  EXPECT_EQ(rmw_names_and_types_get_arena_size(1u, 1u, 10u, nullptr), RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+  EXPECT_EQ(
+    rmw_names_and_types_get_arena_size(1u, SIZE_MAX / 2u, 10u, &arena_size),
+    RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+  EXPECT_EQ(
+    rmw_names_and_types_get_arena_size(1u, 1u, SIZE_MAX, &arena_size), RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+
+  EXPECT_EQ(rmw_names_and_types_get_arena_size(0u, 0u, 0u, &arena_size), RMW_RET_OK);
+  EXPECT_EQ(arena_size, 0u);
+  EXPECT_EQ(rmw_names_and_types_get_arena_size(2u, 3u, 20u, &arena_size), RMW_RET_OK);
+  EXPECT_GE(arena_size, 20u + 3u * sizeof(char *) + 5u);
+}
+
+TEST(rmw_names_and_types, rmw_names_and_types_init_with_arena) {
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+
+  // names_and_types is null
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(nullptr, 1u, 64u, &allocator), RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+
+  // allocator is null or invalid
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 1u, 64u, nullptr),
+    RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 1u, 64u, &invalid_allocator),
+    RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+
+  // names_and_types is not zero initialized
+  rcutils_string_array_t string_array;
+  names_and_types.types = &string_array;
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 1u, 64u, &allocator),
+    RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+  names_and_types.types = nullptr;
+
+  // memory block is too large
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, SIZE_MAX / 2u, 64u, &allocator),
+    RMW_RET_BAD_ALLOC);
+  rmw_reset_error();
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 1u, SIZE_MAX, &allocator),
+    RMW_RET_BAD_ALLOC);
+  rmw_reset_error();
+
+  // allocator fails to allocate memory
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 1u, 64u, &failing_allocator),
+    RMW_RET_BAD_ALLOC);
+  rmw_reset_error();
+  EXPECT_EQ(rmw_names_and_types_check_zero(&names_and_types), RMW_RET_OK);
+
+  // Size == 0 is Ok
+  ASSERT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 0u, 0u, &allocator), RMW_RET_OK);
+  EXPECT_EQ(names_and_types.names.size, 0u);
+  EXPECT_EQ(rmw_names_and_types_fini(&names_and_types), RMW_RET_OK);
+  EXPECT_EQ(rmw_names_and_types_check_zero(&names_and_types), RMW_RET_OK);
+}
+
+TEST(rmw_names_and_types, populate_arena) {
+  const char * names[] = {"/chatter", "/parameter_events", "/rosout"};
+  const std::vector<std::vector<const char *>> types = {
+    {"std_msgs/msg/String", "std_msgs/msg/Header"},
+    {"rcl_interfaces/msg/ParameterEvent"},
+    {},
+  };
+  size_t types_count = 0u;
+  size_t strings_length = 0u;
+  for (size_t i = 0u; i < 3u; ++i) {
+    strings_length += strlen(names[i]);
+    types_count += types[i].size();
+    for (const char * type : types[i]) {
+      strings_length += strlen(type);
+    }
+  }
+  size_t arena_size = 0u;
+  ASSERT_EQ(
+    rmw_names_and_types_get_arena_size(3u, types_count, strings_length, &arena_size),
+    RMW_RET_OK);
+
+  // The memory block is the only allocation
+  rcutils_allocator_t allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_calloc_count(allocator, 1);
+  set_time_bomb_allocator_malloc_count(allocator, 0);
+  set_time_bomb_allocator_realloc_count(allocator, 0);
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 3u, arena_size, &allocator),
+    RMW_RET_OK);
+  set_time_bomb_allocator_calloc_count(allocator, -1);
+  set_time_bomb_allocator_malloc_count(allocator, -1);
+  set_time_bomb_allocator_realloc_count(allocator, -1);
+  ASSERT_EQ(names_and_types.names.size, 3u);
+  ASSERT_NE(names_and_types.types, nullptr);
+
+  rcutils_allocator_t arena_allocator = names_and_types.names.allocator;
+  EXPECT_TRUE(rcutils_allocator_is_valid(&arena_allocator));
+  for (size_t i = 0u; i < 3u; ++i) {
+    EXPECT_EQ(names_and_types.names.data[i], nullptr);
+    names_and_types.names.data[i] = rcutils_strdup(names[i], arena_allocator);
+    ASSERT_NE(names_and_types.names.data[i], nullptr);
+    ASSERT_EQ(
+      rcutils_string_array_init(&names_and_types.types[i], types[i].size(), &arena_allocator),
+      RCUTILS_RET_OK);
+    for (size_t j = 0u; j < types[i].size(); ++j) {
+      names_and_types.types[i].data[j] = rcutils_strdup(types[i][j], arena_allocator);
+      ASSERT_NE(names_and_types.types[i].data[j], nullptr);
+    }
+  }
+  for (size_t i = 0u; i < 3u; ++i) {
+    EXPECT_STREQ(names_and_types.names.data[i], names[i]);
+    ASSERT_EQ(names_and_types.types[i].size, types[i].size());
+    for (size_t j = 0u; j < types[i].size(); ++j) {
+      EXPECT_STREQ(names_and_types.types[i].data[j], types[i][j]);
+    }
+  }
+
+  // Less than the padding of a pointer per string is left
+  EXPECT_EQ(
+    arena_allocator.allocate((3u + types_count) * sizeof(void *), arena_allocator.state),
+    nullptr);
+
+  // Finalizing string arrays one by one is harmless
+  EXPECT_EQ(rcutils_string_array_fini(&names_and_types.types[0]), RCUTILS_RET_OK);
+  EXPECT_EQ(rmw_names_and_types_fini(&names_and_types), RMW_RET_OK);
+  EXPECT_EQ(rmw_names_and_types_check_zero(&names_and_types), RMW_RET_OK);
+}
+
+TEST(rmw_names_and_types, arena_allocator) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(
+    rmw_names_and_types_init_with_arena(&names_and_types, 1u, 8u * sizeof(void *), &allocator),
+    RMW_RET_OK);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(rmw_names_and_types_fini(&names_and_types), RMW_RET_OK);
+  });
+  rcutils_allocator_t arena_allocator = names_and_types.names.allocator;
+  void * state = arena_allocator.state;
+
+  // Allocations are aligned
+  char * first = static_cast<char *>(arena_allocator.allocate(1u, state));
+  ASSERT_NE(first, nullptr);
+  char * second = static_cast<char *>(arena_allocator.zero_allocate(2u, sizeof(void *), state));
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(second, first + sizeof(void *));
+  EXPECT_EQ(second[0], 0);
+
+  // Only the last allocation can be resized
+  EXPECT_EQ(arena_allocator.reallocate(first, 2u * sizeof(void *), state), nullptr);
+  EXPECT_EQ(arena_allocator.reallocate(second, 3u * sizeof(void *), state), second);
+  EXPECT_EQ(arena_allocator.reallocate(second, 8u * sizeof(void *), state), nullptr);
+
+  // Only the last allocation can be reclaimed
+  arena_allocator.deallocate(first, state);
+  arena_allocator.deallocate(second, state);
+  char * third = static_cast<char *>(arena_allocator.allocate(7u * sizeof(void *), state));
+  EXPECT_EQ(third, second);
+  EXPECT_EQ(arena_allocator.allocate(1u, state), nullptr);
+  arena_allocator.deallocate(nullptr, state);
+
+  // Overflowing zero allocations fail
+  EXPECT_EQ(arena_allocator.zero_allocate(SIZE_MAX, 2u, state), nullptr);
+}
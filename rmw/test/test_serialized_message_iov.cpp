@@ -0,0 +1,175 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/serialized_message_iov.h"
+
+TEST(test_serialized_message_iov, default_initialization) {
+  auto iov = rmw_get_zero_initialized_serialized_message_iov();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_init(&iov, 0u, &allocator));
+  EXPECT_EQ(0u, iov.segment_count);
+  EXPECT_EQ(0u, iov.segment_capacity);
+  EXPECT_EQ(nullptr, iov.segments);
+  size_t length = 1u;
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_get_length(&iov, &length));
+  EXPECT_EQ(0u, length);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_fini(&iov));
+  EXPECT_EQ(nullptr, iov.allocator);
+}
+
+TEST(test_serialized_message_iov, append_and_gather) {
+  auto iov = rmw_get_zero_initialized_serialized_message_iov();
+  auto allocator = rcutils_get_default_allocator();
+  uint8_t header[] = {'h', 'd', 'r'};
+  uint8_t payload[] = {'p', 'a', 'y', 'l', 'o', 'a', 'd'};
+  uint8_t trailer[] = {'!'};
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_iov_init(&iov, 1u, &allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, header, sizeof(header)));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, nullptr, 0u));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, payload, sizeof(payload)));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, trailer, sizeof(trailer)));
+  EXPECT_EQ(4u, iov.segment_count);
+  EXPECT_EQ(4u, iov.segment_capacity);
+  // Segments point to the caller bytes, they are not copied
+  EXPECT_EQ(payload, iov.segments[2].data);
+
+  size_t length = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_get_length(&iov, &length));
+  EXPECT_EQ(11u, length);
+
+  // Gathering grows a serialized message that is too small
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 4u, &allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_gather(&iov, &serialized_message));
+  EXPECT_EQ(11u, serialized_message.buffer_length);
+  EXPECT_GE(serialized_message.buffer_capacity, 11u);
+  EXPECT_EQ(0, memcmp("hdrpayload!", serialized_message.buffer, 11u));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_fini(&iov));
+}
+
+TEST(test_serialized_message_iov, scatter) {
+  auto iov = rmw_get_zero_initialized_serialized_message_iov();
+  auto allocator = rcutils_get_default_allocator();
+  uint8_t header[4] = {0};
+  uint8_t payload[8] = {0};
+  const uint8_t * data = reinterpret_cast<const uint8_t *>("0123456789");
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_iov_init(&iov, 2u, &allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, header, sizeof(header)));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, payload, sizeof(payload)));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_scatter(data, 10u, &iov));
+  EXPECT_EQ(0, memcmp("0123", header, 4u));
+  EXPECT_EQ(0, memcmp("456789", payload, 6u));
+  EXPECT_EQ(0u, payload[6]);
+
+  // Too many bytes are rejected without copying anything
+  const uint8_t * other = reinterpret_cast<const uint8_t *>("abcdefghijklm");
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_scatter(other, 13u, &iov));
+  rmw_reset_error();
+  EXPECT_EQ(0, memcmp("0123", header, 4u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_scatter(nullptr, 0u, &iov));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_fini(&iov));
+}
+
+TEST(test_serialized_message_iov, bad_arguments) {
+  auto iov = rmw_get_zero_initialized_serialized_message_iov();
+  auto allocator = rcutils_get_default_allocator();
+  uint8_t byte = 0u;
+  size_t length = 0u;
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_init(nullptr, 1u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_init(&iov, 1u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_serialized_message_iov_init(&iov, SIZE_MAX, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, iov.segments);
+
+  // A zero initialized iov has no allocator to grow with
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_append(&iov, &byte, 1u));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_fini(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_append(nullptr, &byte, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_append(&iov, nullptr, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_get_length(nullptr, &length));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_get_length(&iov, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_gather(nullptr, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_gather(&iov, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_scatter(&byte, 1u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_iov_scatter(nullptr, 1u, &iov));
+  rmw_reset_error();
+
+  // Lengths overflowing size_t are reported
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_iov_init(&iov, 2u, &allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, &byte, SIZE_MAX));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, &byte, 1u));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_serialized_message_iov_get_length(&iov, &length));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_fini(&iov));
+}
+
+TEST(test_serialized_message_iov, failed_allocations) {
+  auto iov = rmw_get_zero_initialized_serialized_message_iov();
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  uint8_t bytes[3] = {0};
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_serialized_message_iov_init(&iov, 1u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, iov.segments);
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_iov_init(&iov, 1u, &failing_allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_append(&iov, &bytes[0], 1u));
+
+  // A failed grow leaves the iov untouched
+  rmw_serialized_message_segment_t * segments = iov.segments;
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_serialized_message_iov_append(&iov, &bytes[1], 2u));
+  rmw_reset_error();
+  EXPECT_EQ(segments, iov.segments);
+  EXPECT_EQ(1u, iov.segment_count);
+  EXPECT_EQ(1u, iov.segment_capacity);
+  EXPECT_EQ(&bytes[0], iov.segments[0].data);
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_iov_fini(&iov));
+}
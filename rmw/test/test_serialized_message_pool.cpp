@@ -0,0 +1,399 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/serialized_message.h"
+#include "rmw/serialized_message_pool.h"
+
+namespace
+{
+// Backing allocator keeping track of the blocks it hands out.
+struct Counters
+{
+  std::atomic<size_t> allocations{0u};
+  std::atomic<size_t> deallocations{0u};
+
+  size_t outstanding() const
+  {
+    return allocations.load() - deallocations.load();
+  }
+};
+
+void *
+counting_allocate(size_t size, void * state)
+{
+  ++static_cast<Counters *>(state)->allocations;
+  return malloc(size);
+}
+
+void
+counting_deallocate(void * pointer, void * state)
+{
+  if (nullptr != pointer) {
+    ++static_cast<Counters *>(state)->deallocations;
+  }
+  free(pointer);
+}
+
+void *
+counting_reallocate(void * pointer, size_t size, void * state)
+{
+  if (nullptr == pointer) {
+    ++static_cast<Counters *>(state)->allocations;
+  }
+  return realloc(pointer, size);
+}
+
+void *
+counting_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  ++static_cast<Counters *>(state)->allocations;
+  return calloc(number_of_elements, size_of_element);
+}
+
+rcutils_allocator_t
+get_counting_allocator(Counters * counters)
+{
+  rcutils_allocator_t allocator = rcutils_get_zero_initialized_allocator();
+  allocator.allocate = counting_allocate;
+  allocator.deallocate = counting_deallocate;
+  allocator.reallocate = counting_reallocate;
+  allocator.zero_allocate = counting_zero_allocate;
+  allocator.state = counters;
+  return allocator;
+}
+}  // namespace
+
+TEST(test_serialized_message_pool, reuses_buffers) {
+  Counters counters;
+  rcutils_allocator_t backing_allocator = get_counting_allocator(&counters);
+  auto options = rmw_get_default_serialized_message_pool_options();
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &backing_allocator));
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+  ASSERT_TRUE(rcutils_allocator_is_valid(&allocator));
+
+  // Warm up
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 100u, &allocator));
+  const uint8_t * buffer = serialized_message.buffer;
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+
+  const size_t allocations = counters.allocations.load();
+  for (size_t i = 0u; i < 100u; ++i) {
+    ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 100u, &allocator));
+    // Handed out again by the thread cache
+    EXPECT_EQ(buffer, serialized_message.buffer);
+    // Still within the 128 bytes size class
+    ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&serialized_message, 128u));
+    EXPECT_EQ(buffer, serialized_message.buffer);
+    memset(serialized_message.buffer, 0xff, 128u);
+    EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+  }
+  EXPECT_EQ(allocations, counters.allocations.load());
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+  EXPECT_EQ(nullptr, pool.impl);
+  EXPECT_EQ(0u, counters.outstanding());
+}
+
+TEST(test_serialized_message_pool, resize_across_size_classes) {
+  Counters counters;
+  rcutils_allocator_t backing_allocator = get_counting_allocator(&counters);
+  auto options = rmw_get_default_serialized_message_pool_options();
+  options.max_block_size = 256u;
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &backing_allocator));
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 64u, &allocator));
+  for (size_t i = 0u; i < 64u; ++i) {
+    serialized_message.buffer[i] = static_cast<uint8_t>(i);
+  }
+  serialized_message.buffer_length = 64u;
+  // Grow to a larger size class, then past the largest one
+  for (size_t size : {200u, 4096u, 100000u}) {
+    ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&serialized_message, size));
+    for (size_t i = 0u; i < 64u; ++i) {
+      ASSERT_EQ(static_cast<uint8_t>(i), serialized_message.buffer[i]);
+    }
+    memset(serialized_message.buffer + 64u, 0, size - 64u);
+  }
+  // And back down
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&serialized_message, 32u));
+  for (size_t i = 0u; i < 32u; ++i) {
+    ASSERT_EQ(static_cast<uint8_t>(i), serialized_message.buffer[i]);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+
+  // Zero allocation clears reused blocks
+  void * pointer = allocator.allocate(16u, allocator.state);
+  ASSERT_NE(nullptr, pointer);
+  memset(pointer, 0xff, 16u);
+  allocator.deallocate(pointer, allocator.state);
+  auto bytes = static_cast<uint8_t *>(allocator.zero_allocate(4u, 4u, allocator.state));
+  ASSERT_NE(nullptr, bytes);
+  for (size_t i = 0u; i < 16u; ++i) {
+    EXPECT_EQ(0u, bytes[i]);
+  }
+  allocator.deallocate(bytes, allocator.state);
+  EXPECT_EQ(nullptr, allocator.zero_allocate(SIZE_MAX, 2u, allocator.state));
+  // Deallocating NULL does nothing
+  allocator.deallocate(nullptr, allocator.state);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+  EXPECT_EQ(0u, counters.outstanding());
+}
+
+TEST(test_serialized_message_pool, bounded_depot) {
+  Counters counters;
+  rcutils_allocator_t backing_allocator = get_counting_allocator(&counters);
+  auto options = rmw_get_default_serialized_message_pool_options();
+  options.thread_cache_capacity = 0u;
+  options.depot_capacity = 4u;
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &backing_allocator));
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+
+  const size_t outstanding = counters.outstanding();
+  std::vector<void *> pointers;
+  for (size_t i = 0u; i < 10u; ++i) {
+    pointers.push_back(allocator.allocate(64u, allocator.state));
+    ASSERT_NE(nullptr, pointers.back());
+  }
+  for (void * pointer : pointers) {
+    allocator.deallocate(pointer, allocator.state);
+  }
+  // Only as many blocks as the depot can keep are kept
+  EXPECT_EQ(outstanding + 4u, counters.outstanding());
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+  EXPECT_EQ(0u, counters.outstanding());
+}
+
+TEST(test_serialized_message_pool, many_pools_per_thread) {
+  Counters counters;
+  rcutils_allocator_t backing_allocator = get_counting_allocator(&counters);
+  auto options = rmw_get_default_serialized_message_pool_options();
+  // More pools than a thread keeps caches for, to cycle through them
+  constexpr size_t kPools = 9u;
+  std::vector<rmw_serialized_message_pool_t> pools(
+    kPools, rmw_get_zero_initialized_serialized_message_pool());
+  for (auto & pool : pools) {
+    ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &backing_allocator));
+  }
+  for (size_t round = 0u; round < 10u; ++round) {
+    for (auto & pool : pools) {
+      rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+      void * pointer = allocator.allocate(1000u, allocator.state);
+      ASSERT_NE(nullptr, pointer);
+      memset(pointer, 0, 1000u);
+      allocator.deallocate(pointer, allocator.state);
+    }
+  }
+  // Finalizing pools while this thread still holds caches for some of them
+  for (size_t i = 0u; i < kPools; i += 2u) {
+    EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pools[i]));
+  }
+  for (size_t i = 1u; i < kPools; i += 2u) {
+    rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pools[i]);
+    void * pointer = allocator.allocate(10u, allocator.state);
+    ASSERT_NE(nullptr, pointer);
+    allocator.deallocate(pointer, allocator.state);
+    EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pools[i]));
+  }
+  EXPECT_EQ(0u, counters.outstanding());
+}
+
+TEST(test_serialized_message_pool, concurrent_use) {
+  Counters counters;
+  rcutils_allocator_t backing_allocator = get_counting_allocator(&counters);
+  auto options = rmw_get_default_serialized_message_pool_options();
+  options.thread_cache_capacity = 4u;
+  options.depot_capacity = 16u;
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &backing_allocator));
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+
+  constexpr size_t kThreads = 8u;
+  constexpr size_t kIterations = 2000u;
+  std::atomic<size_t> failures{0u};
+  std::vector<std::thread> threads;
+  for (size_t t = 0u; t < kThreads; ++t) {
+    threads.emplace_back(
+      [&allocator, &failures, t]() {
+        std::vector<uint8_t *> held;
+        for (size_t i = 0u; i < kIterations; ++i) {
+          const size_t size = 1u + (i * 37u + t * 101u) % 3000u;
+          auto pointer = static_cast<uint8_t *>(allocator.allocate(size, allocator.state));
+          if (nullptr == pointer) {
+            ++failures;
+            continue;
+          }
+          memset(pointer, static_cast<int>(t), size);
+          held.push_back(pointer);
+          // Release blocks in batches, so that caches spill to the depot
+          if (held.size() == 8u) {
+            for (uint8_t * block : held) {
+              if (static_cast<uint8_t>(t) != block[0]) {
+                ++failures;
+              }
+              allocator.deallocate(block, allocator.state);
+            }
+            held.clear();
+          }
+        }
+        for (uint8_t * block : held) {
+          allocator.deallocate(block, allocator.state);
+        }
+        // The thread exits with blocks left in its cache
+      });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0u, failures.load());
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+  EXPECT_EQ(0u, counters.outstanding());
+}
+
+TEST(test_serialized_message_pool, thread_churn) {
+  Counters counters;
+  rcutils_allocator_t backing_allocator = get_counting_allocator(&counters);
+  auto options = rmw_get_default_serialized_message_pool_options();
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &backing_allocator));
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+
+  // Short-lived threads, one after the other, as in a worker thread pool that resizes
+  auto use_pool = [&allocator]() {
+      void * pointer = allocator.allocate(100u, allocator.state);
+      allocator.deallocate(pointer, allocator.state);
+    };
+  std::thread(use_pool).join();
+  const size_t warm_allocations = counters.allocations.load();
+  for (size_t i = 0u; i < 100u; ++i) {
+    std::thread(use_pool).join();
+  }
+  // Exited threads hand their cache over, along with its blocks, to the next thread
+  EXPECT_EQ(warm_allocations, counters.allocations.load());
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+  EXPECT_EQ(0u, counters.outstanding());
+}
+
+TEST(test_serialized_message_pool, bad_arguments) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  auto options = rmw_get_default_serialized_message_pool_options();
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(nullptr, &options, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, &options, nullptr));
+  rmw_reset_error();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_pool_init(&pool, &options, &invalid_allocator));
+  rmw_reset_error();
+
+  auto bad_options = options;
+  bad_options.min_block_size = 100u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, &bad_options, &allocator));
+  rmw_reset_error();
+  bad_options = options;
+  bad_options.max_block_size = 0u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, &bad_options, &allocator));
+  rmw_reset_error();
+  bad_options = options;
+  bad_options.min_block_size = 1u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, &bad_options, &allocator));
+  rmw_reset_error();
+  bad_options = options;
+  bad_options.max_block_size = options.min_block_size / 2u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, &bad_options, &allocator));
+  rmw_reset_error();
+  bad_options = options;
+  bad_options.min_block_size = 8u;
+  bad_options.max_block_size = static_cast<size_t>(8u) << 32u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, &bad_options, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, pool.impl);
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_fini(nullptr));
+  rmw_reset_error();
+  // Finalizing a zero initialized pool does nothing
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+
+  rcutils_allocator_t pool_allocator = rmw_serialized_message_pool_get_allocator(nullptr);
+  EXPECT_FALSE(rcutils_allocator_is_valid(&pool_allocator));
+  pool_allocator = rmw_serialized_message_pool_get_allocator(&pool);
+  EXPECT_FALSE(rcutils_allocator_is_valid(&pool_allocator));
+}
+
+TEST(test_serialized_message_pool, failed_allocation) {
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  auto options = rmw_get_default_serialized_message_pool_options();
+  auto pool = rmw_get_zero_initialized_serialized_message_pool();
+
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_serialized_message_pool_init(&pool, &options, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, pool.impl);
+
+  set_time_bomb_allocator_calloc_count(failing_allocator, -1);
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, &options, &failing_allocator));
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(&pool);
+  // The backing allocator fails to provide a block
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(nullptr, allocator.allocate(64u, allocator.state));
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  // Failing to allocate a thread cache falls back to the depot
+  std::thread thread(
+    [&allocator, &failing_allocator]() {
+      set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+      void * pointer = allocator.allocate(64u, allocator.state);
+      set_time_bomb_allocator_calloc_count(failing_allocator, -1);
+      EXPECT_NE(nullptr, pointer);
+      allocator.deallocate(pointer, allocator.state);
+    });
+  thread.join();
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool));
+}
@@ -0,0 +1,230 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/serialized_message_sequence.h"
+
+static void
+expect_message(
+  const rmw_serialized_message_sequence_t * sequence, size_t index, const char * expected)
+{
+  const uint8_t * data = nullptr;
+  size_t length = 0u;
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_get(sequence, index, &data, &length));
+  ASSERT_EQ(strlen(expected), length);
+  EXPECT_EQ(0, memcmp(expected, data, length));
+}
+
+static rmw_ret_t
+append(rmw_serialized_message_sequence_t * sequence, const char * message)
+{
+  return rmw_serialized_message_sequence_append(
+    sequence, reinterpret_cast<const uint8_t *>(message), strlen(message));
+}
+
+TEST(test_serialized_message_sequence, default_initialization) {
+  auto sequence = rmw_get_zero_initialized_serialized_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_init(&sequence, 0u, 0u, &allocator));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(0u, sequence.capacity);
+  EXPECT_EQ(0u, sequence.buffer_capacity);
+  EXPECT_EQ(nullptr, sequence.offsets);
+
+  // A sequence without storage still grows on append
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "abc"));
+  EXPECT_EQ(1u, sequence.size);
+  expect_message(&sequence, 0u, "abc");
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_fini(&sequence));
+  EXPECT_EQ(0u, sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.offsets);
+  EXPECT_EQ(nullptr, sequence.buffer);
+}
+
+TEST(test_serialized_message_sequence, shared_buffer) {
+  auto sequence = rmw_get_zero_initialized_serialized_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_init(&sequence, 4u, 64u, &allocator));
+  EXPECT_EQ(4u, sequence.capacity);
+  EXPECT_EQ(64u, sequence.buffer_capacity);
+  EXPECT_EQ(0u, sequence.offsets[0]);
+  size_t * offsets = sequence.offsets;
+
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "first"));
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, ""));
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "third one"));
+  EXPECT_EQ(3u, sequence.size);
+  EXPECT_EQ(offsets, sequence.offsets);
+
+  // Messages are stored back to back
+  EXPECT_EQ(0u, sequence.offsets[0]);
+  EXPECT_EQ(5u, sequence.offsets[1]);
+  EXPECT_EQ(5u, sequence.offsets[2]);
+  EXPECT_EQ(14u, sequence.offsets[3]);
+  EXPECT_EQ(0, memcmp("firstthird one", sequence.buffer, 14u));
+  expect_message(&sequence, 0u, "first");
+  expect_message(&sequence, 1u, "");
+  expect_message(&sequence, 2u, "third one");
+
+  // Reset keeps the storage
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_reset(&sequence));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "again"));
+  expect_message(&sequence, 0u, "again");
+  EXPECT_EQ(offsets, sequence.offsets);
+  EXPECT_EQ(4u, sequence.capacity);
+  EXPECT_EQ(64u, sequence.buffer_capacity);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_fini(&sequence));
+}
+
+TEST(test_serialized_message_sequence, grow) {
+  auto sequence = rmw_get_zero_initialized_serialized_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_init(&sequence, 1u, 4u, &allocator));
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "abcd"));
+  // Running out of entries doubles the offset table
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "e"));
+  EXPECT_EQ(2u, sequence.capacity);
+  EXPECT_EQ(8u, sequence.buffer_capacity);
+  // Running out of bytes grows the buffer to at least what is needed
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "fghijklmnopq"));
+  EXPECT_EQ(4u, sequence.capacity);
+  EXPECT_EQ(17u, sequence.buffer_capacity);
+  expect_message(&sequence, 0u, "abcd");
+  expect_message(&sequence, 1u, "e");
+  expect_message(&sequence, 2u, "fghijklmnopq");
+
+  // Reserving preserves contents and never shrinks
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_reserve(&sequence, 16u, 8u));
+  EXPECT_EQ(16u, sequence.capacity);
+  EXPECT_EQ(17u, sequence.buffer_capacity);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_reserve(&sequence, 2u, 1024u));
+  EXPECT_EQ(16u, sequence.capacity);
+  EXPECT_EQ(1024u, sequence.buffer_capacity);
+  EXPECT_EQ(3u, sequence.size);
+  expect_message(&sequence, 0u, "abcd");
+  expect_message(&sequence, 1u, "e");
+  expect_message(&sequence, 2u, "fghijklmnopq");
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_fini(&sequence));
+}
+
+TEST(test_serialized_message_sequence, bad_arguments) {
+  auto sequence = rmw_get_zero_initialized_serialized_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+  const uint8_t * data = nullptr;
+  size_t length = 0u;
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_sequence_init(nullptr, 1u, 1u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_sequence_init(&sequence, 1u, 1u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_serialized_message_sequence_init(&sequence, SIZE_MAX, 1u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_serialized_message_sequence_init(&sequence, 1u, SIZE_MAX, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, sequence.offsets);
+
+  // A zero initialized sequence has no allocator to grow with
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, append(&sequence, "abc"));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_reserve(&sequence, 1u, 1u));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_fini(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_reset(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_reserve(nullptr, 1u, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, append(nullptr, "abc"));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_init(&sequence, 1u, 1u, &allocator));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_append(&sequence, nullptr, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_append(&sequence, nullptr, 0u));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_get(nullptr, 0u, &data, &length));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_sequence_get(&sequence, 0u, nullptr, &length));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_get(&sequence, 0u, &data, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_sequence_get(&sequence, 1u, &data, &length));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_get(&sequence, 0u, &data, &length));
+  EXPECT_EQ(0u, length);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_fini(&sequence));
+}
+
+TEST(test_serialized_message_sequence, failed_allocations) {
+  auto sequence = rmw_get_zero_initialized_serialized_message_sequence();
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_serialized_message_sequence_init(&sequence, 1u, 4u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, sequence.offsets);
+
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_serialized_message_sequence_init(&sequence, 1u, 4u, &failing_allocator));
+  EXPECT_EQ(RMW_RET_OK, append(&sequence, "abcd"));
+
+  // A failed grow leaves the sequence untouched
+  size_t * offsets = sequence.offsets;
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, append(&sequence, "e"));
+  rmw_reset_error();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_serialized_message_sequence_reserve(&sequence, 8u, 8u));
+  rmw_reset_error();
+  EXPECT_EQ(offsets, sequence.offsets);
+  EXPECT_EQ(1u, sequence.size);
+  EXPECT_EQ(1u, sequence.capacity);
+  EXPECT_EQ(4u, sequence.buffer_capacity);
+  expect_message(&sequence, 0u, "abcd");
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_sequence_fini(&sequence));
+}
@@ -0,0 +1,251 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/shared_serialized_message.h"
+
+namespace
+{
+struct DeleterState
+{
+  std::atomic<int> calls{0};
+  uint8_t * buffer{nullptr};
+  size_t buffer_length{0u};
+};
+
+void
+count_deletions(uint8_t * buffer, size_t buffer_length, void * state)
+{
+  auto deleter_state = static_cast<DeleterState *>(state);
+  deleter_state->buffer = buffer;
+  deleter_state->buffer_length = buffer_length;
+  ++deleter_state->calls;
+}
+}  // namespace
+
+TEST(test_shared_serialized_message, init_from_serialized_message) {
+  auto allocator = rcutils_get_default_allocator();
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 16u, &allocator));
+  memcpy(serialized_message.buffer, "payload", 7u);
+  serialized_message.buffer_length = 7u;
+  const uint8_t * buffer = serialized_message.buffer;
+
+  auto shared = rmw_get_zero_initialized_shared_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_shared_serialized_message_init_from(&shared, &serialized_message, &allocator));
+  // The buffer moved, it was not copied
+  EXPECT_EQ(buffer, shared.buffer);
+  EXPECT_EQ(7u, shared.buffer_length);
+  EXPECT_EQ(nullptr, serialized_message.buffer);
+  EXPECT_EQ(0u, serialized_message.buffer_capacity);
+
+  size_t use_count = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_get_use_count(&shared, &use_count));
+  EXPECT_EQ(1u, use_count);
+
+  auto other = rmw_get_zero_initialized_shared_serialized_message();
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_acquire(&shared, &other));
+  EXPECT_EQ(buffer, other.buffer);
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_get_use_count(&other, &use_count));
+  EXPECT_EQ(2u, use_count);
+
+  auto view = rmw_get_zero_initialized_serialized_message();
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_get_view(&other, &view));
+  EXPECT_EQ(buffer, view.buffer);
+  EXPECT_EQ(7u, view.buffer_length);
+  EXPECT_FALSE(rcutils_allocator_is_valid(&view.allocator));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_fini(&shared));
+  EXPECT_EQ(nullptr, shared.impl);
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_get_use_count(&shared, &use_count));
+  EXPECT_EQ(0u, use_count);
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_get_use_count(&other, &use_count));
+  EXPECT_EQ(1u, use_count);
+  EXPECT_EQ(0, memcmp("payload", other.buffer, 7u));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_fini(&other));
+
+  // Giving back a zero initialized reference does nothing
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_fini(&other));
+}
+
+TEST(test_shared_serialized_message, custom_deleter) {
+  auto allocator = rcutils_get_default_allocator();
+  uint8_t buffer[4] = {1u, 2u, 3u, 4u};
+  DeleterState state;
+
+  auto shared = rmw_get_zero_initialized_shared_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_shared_serialized_message_init_with_deleter(
+      &shared, buffer, sizeof(buffer), count_deletions, &state, &allocator));
+  auto other = rmw_get_zero_initialized_shared_serialized_message();
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_acquire(&shared, &other));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_fini(&other));
+  EXPECT_EQ(0, state.calls.load());
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_fini(&shared));
+  EXPECT_EQ(1, state.calls.load());
+  EXPECT_EQ(buffer, state.buffer);
+  EXPECT_EQ(sizeof(buffer), state.buffer_length);
+}
+
+TEST(test_shared_serialized_message, concurrent_release) {
+  auto allocator = rcutils_get_default_allocator();
+  uint8_t buffer[1] = {0u};
+  DeleterState state;
+  constexpr size_t kThreads = 8u;
+  constexpr size_t kIterations = 1000u;
+
+  for (size_t iteration = 0u; iteration < kIterations; ++iteration) {
+    auto shared = rmw_get_zero_initialized_shared_serialized_message();
+    ASSERT_EQ(
+      RMW_RET_OK,
+      rmw_shared_serialized_message_init_with_deleter(
+        &shared, buffer, sizeof(buffer), count_deletions, &state, &allocator));
+    std::vector<rmw_shared_serialized_message_t> references(
+      kThreads, rmw_get_zero_initialized_shared_serialized_message());
+    for (auto & reference : references) {
+      ASSERT_EQ(RMW_RET_OK, rmw_shared_serialized_message_acquire(&shared, &reference));
+    }
+    ASSERT_EQ(RMW_RET_OK, rmw_shared_serialized_message_fini(&shared));
+
+    std::vector<std::thread> threads;
+    std::atomic<size_t> failures{0u};
+    for (auto & reference : references) {
+      threads.emplace_back(
+        [&reference, &failures]() {
+          if (RMW_RET_OK != rmw_shared_serialized_message_fini(&reference)) {
+            ++failures;
+          }
+        });
+    }
+    for (auto & thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(0u, failures.load());
+    ASSERT_EQ(static_cast<int>(iteration + 1u), state.calls.load());
+  }
+}
+
+TEST(test_shared_serialized_message, bad_arguments) {
+  auto allocator = rcutils_get_default_allocator();
+  auto shared = rmw_get_zero_initialized_shared_serialized_message();
+  auto other = rmw_get_zero_initialized_shared_serialized_message();
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  uint8_t byte = 0u;
+  size_t use_count = 0u;
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_from(nullptr, &serialized_message, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_from(&shared, nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_from(&shared, &serialized_message, nullptr));
+  rmw_reset_error();
+  // A zero initialized serialized message has no allocator to release its buffer with
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_from(&shared, &serialized_message, &allocator));
+  rmw_reset_error();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_with_deleter(
+      nullptr, &byte, 1u, count_deletions, nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_with_deleter(
+      &shared, nullptr, 1u, count_deletions, nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_with_deleter(
+      &shared, &byte, 1u, nullptr, nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_init_with_deleter(
+      &shared, &byte, 1u, count_deletions, nullptr, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, shared.impl);
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_acquire(nullptr, &other));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_acquire(&shared, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_acquire(&shared, &other));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_fini(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_get_use_count(nullptr, &use_count));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_get_use_count(&shared, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_serialized_message_get_view(nullptr, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_get_view(&shared, nullptr));
+  rmw_reset_error();
+}
+
+TEST(test_shared_serialized_message, failed_allocation) {
+  auto allocator = rcutils_get_default_allocator();
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  auto serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 8u, &allocator));
+  uint8_t * buffer = serialized_message.buffer;
+
+  auto shared = rmw_get_zero_initialized_shared_serialized_message();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_shared_serialized_message_init_from(&shared, &serialized_message, &failing_allocator));
+  rmw_reset_error();
+  // The serialized message keeps its buffer
+  EXPECT_EQ(buffer, serialized_message.buffer);
+  EXPECT_EQ(nullptr, shared.impl);
+
+  DeleterState state;
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_shared_serialized_message_init_with_deleter(
+      &shared, buffer, 8u, count_deletions, &state, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(0, state.calls.load());
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+}
@@ -0,0 +1,23 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gmock/gmock.h"
+#include "rmw/streaming_deserializer.h"
+
+TEST(rmw_streaming_deserializer, get_zero_initialized_streaming_deserializer)
+{
+  const rmw_streaming_deserializer_t actual = rmw_get_zero_initialized_streaming_deserializer();
+  EXPECT_EQ(nullptr, actual.implementation_identifier);
+  EXPECT_EQ(nullptr, actual.data);
+}
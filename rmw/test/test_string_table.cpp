@@ -0,0 +1,222 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/string_table.h"
+
+class TestStringTable : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rcutils_allocator_t allocator = rcutils_get_default_allocator();
+    ASSERT_EQ(RMW_RET_OK, rmw_string_table_init(&table, &allocator));
+  }
+
+  void TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_string_table_fini(&table));
+  }
+
+  size_t size()
+  {
+    size_t size = 0u;
+    EXPECT_EQ(RMW_RET_OK, rmw_string_table_get_size(&table, &size));
+    return size;
+  }
+
+  rmw_string_table_t table = rmw_get_zero_initialized_string_table();
+};
+
+TEST(test_string_table, get_zero_initialized_string_table) {
+  const rmw_string_table_t table = rmw_get_zero_initialized_string_table();
+  EXPECT_EQ(nullptr, table.impl);
+}
+
+TEST(test_string_table, init_fini_invalid_arguments) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_string_table_t table = rmw_get_zero_initialized_string_table();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_init(nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_init(&table, nullptr));
+  rmw_reset_error();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_init(&table, &invalid_allocator));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_init(&table, &allocator));
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_init(&table, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_string_table_fini(&table));
+  EXPECT_EQ(nullptr, table.impl);
+  // Finalizing twice is harmless
+  EXPECT_EQ(RMW_RET_OK, rmw_string_table_fini(&table));
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_fini(nullptr));
+  rmw_reset_error();
+
+  // Tables need to be initialized to be used
+  const char * interned = nullptr;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_intern(&table, "/chatter", &interned));
+  rmw_reset_error();
+  size_t size = 0u;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_get_size(&table, &size));
+  rmw_reset_error();
+}
+
+TEST(test_string_table, init_bad_alloc) {
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  rmw_string_table_t table = rmw_get_zero_initialized_string_table();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_string_table_init(&table, &failing_allocator));
+  rmw_reset_error();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 1);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_string_table_init(&table, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, table.impl);
+
+  set_time_bomb_allocator_calloc_count(failing_allocator, -1);
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_init(&table, &failing_allocator));
+  const char * interned = nullptr;
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_string_table_intern(&table, "/chatter", &interned));
+  rmw_reset_error();
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  EXPECT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, "/chatter", &interned));
+  EXPECT_STREQ("/chatter", interned);
+  EXPECT_EQ(RMW_RET_OK, rmw_string_table_fini(&table));
+}
+
+TEST_F(TestStringTable, intern_invalid_arguments) {
+  const char * interned = nullptr;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_intern(nullptr, "/chatter", &interned));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_intern(&table, nullptr, &interned));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_intern(&table, "/chatter", nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_string_table_intern_with_size(&table, nullptr, 0u, &interned));
+  rmw_reset_error();
+  size_t size = 0u;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_get_size(nullptr, &size));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_string_table_get_size(&table, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(0u, this->size());
+}
+
+TEST_F(TestStringTable, intern) {
+  std::string chatter = "/chatter";
+  const char * first = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, chatter.c_str(), &first));
+  EXPECT_STREQ("/chatter", first);
+  EXPECT_NE(chatter.c_str(), first);
+  // The table holds a copy of its own
+  chatter[1] = 'C';
+  EXPECT_STREQ("/chatter", first);
+
+  const char * second = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, "/chatter", &second));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(1u, size());
+
+  const char * other = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, "/Chatter", &other));
+  EXPECT_NE(first, other);
+  const char * empty = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, "", &empty));
+  EXPECT_STREQ("", empty);
+  EXPECT_EQ(3u, size());
+}
+
+TEST_F(TestStringTable, intern_with_size) {
+  const char buffer[] = "/chatter/more";
+  const char * prefix = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern_with_size(&table, buffer, 8u, &prefix));
+  EXPECT_STREQ("/chatter", prefix);
+  const char * chatter = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, "/chatter", &chatter));
+  EXPECT_EQ(prefix, chatter);
+
+  // Embedded null characters are part of the string
+  const char with_null[] = "a\0b";
+  const char * interned_with_null = nullptr;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_string_table_intern_with_size(&table, with_null, 3u, &interned_with_null));
+  const char * a = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, "a", &a));
+  EXPECT_NE(interned_with_null, a);
+  EXPECT_EQ(0, memcmp(with_null, interned_with_null, sizeof(with_null)));
+  EXPECT_EQ(3u, size());
+}
+
+TEST_F(TestStringTable, pointers_are_stable_while_growing) {
+  constexpr size_t count = 10000u;
+  std::vector<const char *> interned(count);
+  for (size_t i = 0u; i < count; ++i) {
+    const std::string name = "/topic_" + std::to_string(i);
+    ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, name.c_str(), &interned[i]));
+  }
+  EXPECT_EQ(count, size());
+  for (size_t i = 0u; i < count; ++i) {
+    const std::string name = "/topic_" + std::to_string(i);
+    const char * again = nullptr;
+    ASSERT_EQ(RMW_RET_OK, rmw_string_table_intern(&table, name.c_str(), &again));
+    EXPECT_EQ(interned[i], again);
+    EXPECT_STREQ(name.c_str(), interned[i]);
+  }
+  EXPECT_EQ(count, size());
+}
+
+TEST_F(TestStringTable, concurrent_interning) {
+  constexpr size_t thread_count = 4u;
+  constexpr size_t name_count = 2000u;
+  std::vector<std::vector<const char *>> interned(
+    thread_count, std::vector<const char *>(name_count, nullptr));
+  std::vector<std::thread> threads;
+  for (size_t t = 0u; t < thread_count; ++t) {
+    threads.emplace_back(
+      [this, t, &interned]() {
+        // All threads intern the same names, starting at different ones
+        for (size_t i = 0u; i < name_count; ++i) {
+          const size_t n = (i + t * name_count / thread_count) % name_count;
+          const std::string name = "/robot/topic_" + std::to_string(n);
+          if (RMW_RET_OK != rmw_string_table_intern(&table, name.c_str(), &interned[t][n])) {
+            rmw_reset_error();
+          }
+        }
+      });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(name_count, size());
+  for (size_t n = 0u; n < name_count; ++n) {
+    ASSERT_NE(nullptr, interned[0][n]);
+    for (size_t t = 1u; t < thread_count; ++t) {
+      EXPECT_EQ(interned[0][n], interned[t][n]);
+    }
+  }
+}
@@ -17,6 +17,7 @@
 #include "rcutils/allocator.h"
 
 #include "rmw/error_handling.h"
+#include "rmw/string_table.h"
 #include "rmw/topic_endpoint_info.h"
 #include "rmw/types.h"
 
@@ -315,3 +316,65 @@ TEST(test_topic_endpoint_info, fini) {
   EXPECT_EQ(topic_endpoint_info.qos_profile.avoid_ros_namespace_conventions, false) <<
     "Non-zero avoid namespace conventions";
 }
+
+TEST(test_topic_endpoint_info, set_interned) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_string_table_t string_table = rmw_get_zero_initialized_string_table();
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_init(&string_table, &allocator));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_string_table_fini(&string_table));
+  });
+
+  rmw_topic_endpoint_info_t first = rmw_get_zero_initialized_topic_endpoint_info();
+  rmw_topic_endpoint_info_t second = rmw_get_zero_initialized_topic_endpoint_info();
+  EXPECT_EQ(0u, first.interned_strings);
+
+  rmw_ret_t ret = rmw_topic_endpoint_info_set_topic_type_interned(nullptr, "type", &string_table);
+  EXPECT_EQ(ret, RMW_RET_INVALID_ARGUMENT) <<
+    "Expected invalid argument for null topic_endpoint_info";
+  rmw_reset_error();
+  ret = rmw_topic_endpoint_info_set_topic_type_interned(&first, nullptr, &string_table);
+  EXPECT_EQ(ret, RMW_RET_INVALID_ARGUMENT) << "Expected invalid argument for null topic_type";
+  rmw_reset_error();
+  ret = rmw_topic_endpoint_info_set_topic_type_interned(&first, "type", nullptr);
+  EXPECT_EQ(ret, RMW_RET_INVALID_ARGUMENT) << "Expected invalid argument for null string_table";
+  rmw_reset_error();
+  EXPECT_EQ(0u, first.interned_strings);
+
+  for (rmw_topic_endpoint_info_t * info : {&first, &second}) {
+    ret = rmw_topic_endpoint_info_set_topic_type_interned(info, "type", &string_table);
+    EXPECT_EQ(ret, RMW_RET_OK) << "Expected OK for valid topic_type arguments";
+    ret = rmw_topic_endpoint_info_set_node_name_interned(info, "name", &string_table);
+    EXPECT_EQ(ret, RMW_RET_OK) << "Expected OK for valid node_name arguments";
+    ret = rmw_topic_endpoint_info_set_node_namespace_interned(info, "namespace", &string_table);
+    EXPECT_EQ(ret, RMW_RET_OK) << "Expected OK for valid node_namespace arguments";
+  }
+  // Both infos share the same strings
+  EXPECT_STREQ("type", first.topic_type);
+  EXPECT_EQ(first.topic_type, second.topic_type);
+  EXPECT_STREQ("name", first.node_name);
+  EXPECT_EQ(first.node_name, second.node_name);
+  EXPECT_STREQ("namespace", first.node_namespace);
+  EXPECT_EQ(first.node_namespace, second.node_namespace);
+  EXPECT_EQ(
+    RMW_TOPIC_ENDPOINT_INFO_TOPIC_TYPE_INTERNED | RMW_TOPIC_ENDPOINT_INFO_NODE_NAME_INTERNED |
+    RMW_TOPIC_ENDPOINT_INFO_NODE_NAMESPACE_INTERNED, first.interned_strings);
+  size_t size = 0u;
+  ASSERT_EQ(RMW_RET_OK, rmw_string_table_get_size(&string_table, &size));
+  EXPECT_EQ(3u, size);
+
+  // Interned strings are left to the table, owned ones are deallocated
+  ret = rmw_topic_endpoint_info_fini(&first, &allocator);
+  EXPECT_EQ(ret, RMW_RET_OK) << "Expected OK for valid fini arguments";
+  EXPECT_FALSE(first.topic_type);
+  EXPECT_EQ(0u, first.interned_strings);
+  ret = rmw_topic_endpoint_info_set_node_name(&second, "owned_name", &allocator);
+  EXPECT_EQ(ret, RMW_RET_OK) << "Expected OK for valid node_name arguments";
+  EXPECT_EQ(
+    RMW_TOPIC_ENDPOINT_INFO_TOPIC_TYPE_INTERNED |
+    RMW_TOPIC_ENDPOINT_INFO_NODE_NAMESPACE_INTERNED, second.interned_strings);
+  ret = rmw_topic_endpoint_info_fini(&second, &allocator);
+  EXPECT_EQ(ret, RMW_RET_OK) << "Expected OK for valid fini arguments";
+  EXPECT_FALSE(second.node_name);
+}
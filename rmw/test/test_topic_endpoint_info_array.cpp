@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
+
 #include "gmock/gmock.h"
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 #include "rcutils/allocator.h"
@@ -99,3 +101,43 @@ TEST(test_topic_endpoint_info_array, check_fini) {
   EXPECT_EQ(rmw_topic_endpoint_info_array_fini(nullptr, &allocator), RMW_RET_INVALID_ARGUMENT);
   rmw_reset_error();
 }
+
+TEST(test_topic_endpoint_info_array, sort_by_gid) {
+  EXPECT_EQ(rmw_topic_endpoint_info_array_sort_by_gid(nullptr), RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+  rmw_topic_endpoint_info_array_t arr = rmw_get_zero_initialized_topic_endpoint_info_array();
+  EXPECT_EQ(rmw_topic_endpoint_info_array_sort_by_gid(&arr), RMW_RET_OK);
+  arr.size = 1u;
+  EXPECT_EQ(rmw_topic_endpoint_info_array_sort_by_gid(&arr), RMW_RET_INVALID_ARGUMENT);
+  rmw_reset_error();
+  arr.size = 0u;
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(rmw_topic_endpoint_info_array_init_with_size(&arr, 4, &allocator), RMW_RET_OK);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(rmw_topic_endpoint_info_array_fini(&arr, &allocator), RMW_RET_OK);
+  });
+  // GIDs sharing a prefix, as those of endpoints of the same participant do
+  const uint8_t last_bytes[] = {3u, 1u, 4u, 2u};
+  for (size_t i = 0u; i < arr.size; ++i) {
+    memset(arr.info_array[i].endpoint_gid, 0xab, RMW_GID_STORAGE_SIZE);
+    arr.info_array[i].endpoint_gid[RMW_GID_STORAGE_SIZE - 1u] = last_bytes[i];
+    arr.info_array[i].endpoint_type =
+      last_bytes[i] % 2u ? RMW_ENDPOINT_PUBLISHER : RMW_ENDPOINT_SUBSCRIPTION;
+  }
+  arr.info_array[3].endpoint_gid[0] = 0u;
+  EXPECT_EQ(rmw_topic_endpoint_info_array_sort_by_gid(&arr), RMW_RET_OK);
+  EXPECT_EQ(arr.info_array[0].endpoint_gid[0], 0u);
+  EXPECT_EQ(arr.info_array[0].endpoint_gid[RMW_GID_STORAGE_SIZE - 1u], 2u);
+  EXPECT_EQ(arr.info_array[1].endpoint_gid[RMW_GID_STORAGE_SIZE - 1u], 1u);
+  EXPECT_EQ(arr.info_array[2].endpoint_gid[RMW_GID_STORAGE_SIZE - 1u], 3u);
+  EXPECT_EQ(arr.info_array[3].endpoint_gid[RMW_GID_STORAGE_SIZE - 1u], 4u);
+  // Elements are moved along with their GIDs
+  for (size_t i = 0u; i < arr.size; ++i) {
+    EXPECT_EQ(
+      arr.info_array[i].endpoint_type,
+      arr.info_array[i].endpoint_gid[RMW_GID_STORAGE_SIZE - 1u] % 2u ?
+      RMW_ENDPOINT_PUBLISHER : RMW_ENDPOINT_SUBSCRIPTION);
+  }
+}
@@ -0,0 +1,277 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/topic_endpoint_info_index.h"
+
+namespace
+{
+constexpr size_t kNodeCount = 10u;
+constexpr size_t kEndpointCount = 1000u;
+
+// Endpoints of a few nodes, with GIDs sharing a prefix as those of a participant do.
+class TestTopicEndpointInfoIndex : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    for (size_t n = 0u; n < kNodeCount; ++n) {
+      node_names.push_back("node_" + std::to_string(n));
+    }
+    infos.resize(kEndpointCount, rmw_get_zero_initialized_topic_endpoint_info());
+    for (size_t i = 0u; i < kEndpointCount; ++i) {
+      infos[i].node_name = node_names[i % kNodeCount].c_str();
+      infos[i].node_namespace = "/robot";
+      make_gid(i, infos[i].endpoint_gid);
+    }
+    array.size = infos.size();
+    array.info_array = infos.data();
+  }
+
+  static void make_gid(size_t i, uint8_t * gid)
+  {
+    memset(gid, 0x42, RMW_GID_STORAGE_SIZE);
+    memcpy(gid + RMW_GID_STORAGE_SIZE - sizeof(i), &i, sizeof(i));
+  }
+
+  std::vector<std::string> node_names;
+  std::vector<rmw_topic_endpoint_info_t> infos;
+  rmw_topic_endpoint_info_array_t array = rmw_get_zero_initialized_topic_endpoint_info_array();
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+};
+}  // namespace
+
+TEST_F(TestTopicEndpointInfoIndex, get_zero_initialized_topic_endpoint_info_index) {
+  const rmw_topic_endpoint_info_index_t index =
+    rmw_get_zero_initialized_topic_endpoint_info_index();
+  EXPECT_EQ(nullptr, index.topic_endpoint_info_array);
+  EXPECT_EQ(0u, index.capacity);
+  EXPECT_EQ(nullptr, index.gid_slots);
+  EXPECT_EQ(nullptr, index.node_slots);
+  EXPECT_EQ(nullptr, index.node_next);
+}
+
+TEST_F(TestTopicEndpointInfoIndex, init_fini_invalid_arguments) {
+  rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_init(nullptr, &array, false, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_init(&index, nullptr, false, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_init(&index, &array, false, nullptr));
+  rmw_reset_error();
+  rmw_topic_endpoint_info_array_t no_storage = {1u, nullptr};
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_init(&index, &no_storage, false, &allocator));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_init(&index, &array, false, &allocator));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_init(&index, &array, false, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_fini(&index));
+  EXPECT_EQ(nullptr, index.gid_slots);
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_fini(&index));
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_topic_endpoint_info_index_fini(nullptr));
+  rmw_reset_error();
+
+  // Lookups need an initialized index
+  const rmw_topic_endpoint_info_t * info = nullptr;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_gid(&index, infos[0].endpoint_gid, &info));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", "/robot", nullptr, &info));
+  rmw_reset_error();
+}
+
+TEST_F(TestTopicEndpointInfoIndex, init_bad_alloc) {
+  rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_topic_endpoint_info_index_init(&index, &array, false, &failing_allocator));
+  rmw_reset_error();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 1);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_topic_endpoint_info_index_init(&index, &array, true, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, index.gid_slots);
+  EXPECT_EQ(nullptr, index.topic_endpoint_info_array);
+}
+
+TEST_F(TestTopicEndpointInfoIndex, find_by_gid) {
+  rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_init(&index, &array, false, &allocator));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_fini(&index));
+  });
+
+  const rmw_topic_endpoint_info_t * info = nullptr;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_gid(nullptr, infos[0].endpoint_gid, &info));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_topic_endpoint_info_index_find_by_gid(&index, nullptr, &info));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_gid(&index, infos[0].endpoint_gid, nullptr));
+  rmw_reset_error();
+
+  for (size_t i = 0u; i < kEndpointCount; ++i) {
+    uint8_t gid[RMW_GID_STORAGE_SIZE];
+    make_gid(i, gid);
+    ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_find_by_gid(&index, gid, &info));
+    EXPECT_EQ(&infos[i], info);
+  }
+  uint8_t unknown_gid[RMW_GID_STORAGE_SIZE];
+  make_gid(kEndpointCount, unknown_gid);
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_find_by_gid(&index, unknown_gid, &info));
+  EXPECT_EQ(nullptr, info);
+
+  // Nodes were not indexed
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", "/robot", nullptr, &info));
+  rmw_reset_error();
+}
+
+TEST_F(TestTopicEndpointInfoIndex, find_by_node) {
+  // Elements without node are not indexed by node
+  infos[0].node_name = nullptr;
+  rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_init(&index, &array, true, &allocator));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_fini(&index));
+  });
+
+  const rmw_topic_endpoint_info_t * info = nullptr;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, nullptr, "/robot", nullptr, &info));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", nullptr, nullptr, &info));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", "/robot", nullptr, nullptr));
+  rmw_reset_error();
+
+  // Elements of a node are found in array order
+  for (size_t n = 0u; n < kNodeCount; ++n) {
+    std::vector<const rmw_topic_endpoint_info_t *> found;
+    const rmw_topic_endpoint_info_t * previous = nullptr;
+    do {
+      ASSERT_EQ(
+        RMW_RET_OK, rmw_topic_endpoint_info_index_find_by_node(
+          &index, node_names[n].c_str(), "/robot", previous, &info));
+      if (nullptr != info) {
+        found.push_back(info);
+      }
+      previous = info;
+    } while (nullptr != info);
+    std::vector<const rmw_topic_endpoint_info_t *> expected;
+    for (size_t i = n == 0u ? kNodeCount : n; i < kEndpointCount; i += kNodeCount) {
+      expected.push_back(&infos[i]);
+    }
+    EXPECT_EQ(expected, found);
+  }
+
+  // Previous elements must be elements of the given node
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_2", "/robot", &infos[1], &info));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", "/robot", &infos[0], &info));
+  rmw_reset_error();
+  const rmw_topic_endpoint_info_t outside = infos[10];
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", "/robot", &outside, &info));
+  rmw_reset_error();
+
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_topic_endpoint_info_index_find_by_node(
+      &index, "node_0", "/other_robot", nullptr, &info));
+  EXPECT_EQ(nullptr, info);
+}
+
+TEST_F(TestTopicEndpointInfoIndex, find_by_node_single_node) {
+  // All endpoints of one node share a table slot, and are chained from it
+  for (rmw_topic_endpoint_info_t & info : infos) {
+    info.node_name = node_names[0].c_str();
+  }
+  rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_init(&index, &array, true, &allocator));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_fini(&index));
+  });
+  size_t occupied_slots = 0u;
+  for (size_t slot = 0u; slot < index.capacity; ++slot) {
+    occupied_slots += 0u != index.node_slots[slot] ? 1u : 0u;
+  }
+  EXPECT_EQ(1u, occupied_slots);
+
+  const rmw_topic_endpoint_info_t * info = nullptr;
+  for (size_t i = 0u; i <= kEndpointCount; ++i) {
+    const rmw_topic_endpoint_info_t * previous = 0u != i ? &infos[i - 1u] : nullptr;
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_topic_endpoint_info_index_find_by_node(
+        &index, "node_0", "/robot", previous, &info));
+    EXPECT_EQ(i < kEndpointCount ? &infos[i] : nullptr, info);
+  }
+}
+
+TEST_F(TestTopicEndpointInfoIndex, empty_array) {
+  rmw_topic_endpoint_info_array_t empty = rmw_get_zero_initialized_topic_endpoint_info_array();
+  rmw_topic_endpoint_info_index_t index = rmw_get_zero_initialized_topic_endpoint_info_index();
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_init(&index, &empty, true, &allocator));
+  const rmw_topic_endpoint_info_t * info = nullptr;
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_topic_endpoint_info_index_find_by_gid(&index, infos[0].endpoint_gid, &info));
+  EXPECT_EQ(nullptr, info);
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_topic_endpoint_info_index_find_by_node(&index, "node_0", "/robot", nullptr, &info));
+  EXPECT_EQ(nullptr, info);
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_index_fini(&index));
+}
@@ -0,0 +1,153 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/topic_filter.h"
+
+namespace
+{
+bool
+matches(const char * pattern, const char * topic_name)
+{
+  bool result = false;
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_name_matches(pattern, topic_name, &result));
+  return result;
+}
+
+// Exhaustive matching, straight from the definition of each wildcard.
+bool
+reference_matches(const char * pattern, const char * name)
+{
+  if ('\0' == *pattern) {
+    return '\0' == *name;
+  }
+  if ('*' == pattern[0] && '*' == pattern[1]) {
+    for (const char * rest = name; ; ++rest) {
+      if (reference_matches(pattern + 2, rest)) {
+        return true;
+      }
+      if ('\0' == *rest) {
+        return false;
+      }
+    }
+  }
+  if ('*' == *pattern) {
+    for (const char * rest = name; ; ++rest) {
+      if (reference_matches(pattern + 1, rest)) {
+        return true;
+      }
+      if ('\0' == *rest || '/' == *rest) {
+        return false;
+      }
+    }
+  }
+  if ('\0' == *name) {
+    return false;
+  }
+  if ('?' == *pattern) {
+    return '/' != *name && reference_matches(pattern + 1, name + 1);
+  }
+  return *pattern == *name && reference_matches(pattern + 1, name + 1);
+}
+}  // namespace
+
+TEST(test_topic_filter, get_zero_initialized_topic_filter) {
+  const rmw_topic_filter_t filter = rmw_get_zero_initialized_topic_filter();
+  EXPECT_EQ(nullptr, filter.pattern);
+  EXPECT_EQ(RMW_ENDPOINT_INVALID, filter.endpoint_type);
+}
+
+TEST(test_topic_filter, matches_invalid_arguments) {
+  bool result = false;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_topic_name_matches(nullptr, "/chatter", &result));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_topic_name_matches("/chatter", nullptr, &result));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_topic_name_matches("/chatter", "/chatter", nullptr));
+  rmw_reset_error();
+}
+
+TEST(test_topic_filter, matches) {
+  // Literal patterns
+  EXPECT_TRUE(matches("/chatter", "/chatter"));
+  EXPECT_FALSE(matches("/chatter", "/chatter2"));
+  EXPECT_FALSE(matches("/chatter2", "/chatter"));
+  EXPECT_TRUE(matches("", "/chatter"));
+
+  // Namespace globs
+  EXPECT_TRUE(matches("/robot1/**", "/robot1/chatter"));
+  EXPECT_TRUE(matches("/robot1/**", "/robot1/camera/image_raw"));
+  EXPECT_FALSE(matches("/robot1/**", "/robot1"));
+  EXPECT_FALSE(matches("/robot1/**", "/robot10/chatter"));
+  EXPECT_FALSE(matches("/robot1/**", "/robot2/chatter"));
+  EXPECT_TRUE(matches("/**/image_raw", "/robot1/camera/image_raw"));
+  EXPECT_FALSE(matches("/**/image_raw", "/robot1/camera/image_rect"));
+  EXPECT_TRUE(matches("**", "/anything/at/all"));
+
+  // Token wildcards
+  EXPECT_TRUE(matches("/robot?/camera_*", "/robot1/camera_left"));
+  EXPECT_FALSE(matches("/robot?/camera_*", "/robot1/camera_left/image"));
+  EXPECT_FALSE(matches("/robot?/camera_*", "/robot12/camera_left"));
+  EXPECT_TRUE(matches("/*/chatter", "/robot1/chatter"));
+  EXPECT_FALSE(matches("/*/chatter", "/fleet/robot1/chatter"));
+  EXPECT_TRUE(matches("/robot*/**/image_*", "/robot1/camera/left/image_raw"));
+  EXPECT_FALSE(matches("/robot*/**/image_*", "/robot1/camera/left/image_raw/compressed"));
+  EXPECT_FALSE(matches("/?", "//"));
+}
+
+TEST(test_topic_filter, matches_as_defined) {
+  // Random patterns and names out of a small alphabet, to make matches likely
+  std::mt19937 generator(42u);
+  const std::string pattern_alphabet = "ab/*?";
+  const std::string name_alphabet = "ab/";
+  std::uniform_int_distribution<size_t> length_distribution(0u, 8u);
+  for (size_t i = 0u; i < 20000u; ++i) {
+    std::string pattern(length_distribution(generator), 'a');
+    for (char & c : pattern) {
+      c = pattern_alphabet[generator() % pattern_alphabet.size()];
+    }
+    std::string name(length_distribution(generator), 'a');
+    for (char & c : name) {
+      c = name_alphabet[generator() % name_alphabet.size()];
+    }
+    if (pattern.empty()) {
+      continue;
+    }
+    ASSERT_EQ(
+      reference_matches(pattern.c_str(), name.c_str()), matches(pattern.c_str(), name.c_str())) <<
+      "pattern '" << pattern << "', name '" << name << "'";
+  }
+}
+
+TEST(test_topic_filter, get_prefix_length) {
+  size_t prefix_length = 0u;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_topic_pattern_get_prefix_length(nullptr, &prefix_length));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_topic_pattern_get_prefix_length("/chatter", nullptr));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_pattern_get_prefix_length("/robot1/**", &prefix_length));
+  EXPECT_EQ(8u, prefix_length);
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_pattern_get_prefix_length("/robot?/chatter", &prefix_length));
+  EXPECT_EQ(6u, prefix_length);
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_pattern_get_prefix_length("/chatter", &prefix_length));
+  EXPECT_EQ(8u, prefix_length);
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_pattern_get_prefix_length("**", &prefix_length));
+  EXPECT_EQ(0u, prefix_length);
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gmock/gmock.h"
+
+#include "rcutils/types/string_array.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/validate_full_topic_name.h"
+#include "rmw/validate_namespace.h"
+#include "rmw/validate_node_name.h"
+
+// The batch loop is shared by all validators, so it is exercised through the topic name one.
+TEST(test_validate_names_batch, batch) {
+  char valid[] = "/valid/topic";
+  char not_absolute[] = "not/absolute";
+  char numbered_token[] = "/token/42";
+  char * data[] = {valid, not_absolute, numbered_token};
+  rcutils_string_array_t names = rcutils_get_zero_initialized_string_array();
+  names.size = 3u;
+  names.data = data;
+  int validation_results[3] = {-1, -1, -1};
+  size_t invalid_indices[3] = {42u, 42u, 42u};
+  rmw_ret_t ret = rmw_validate_full_topic_names_batch(
+    &names, nullptr, validation_results, invalid_indices);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[0]);
+  EXPECT_EQ(42u, invalid_indices[0]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NOT_ABSOLUTE, validation_results[1]);
+  EXPECT_EQ(0u, invalid_indices[1]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, validation_results[2]);
+  EXPECT_EQ(7u, invalid_indices[2]);
+
+  // only the given lengths are validated, here "/valid", "n" and "/token/"
+  const size_t lengths[3] = {6u, 1u, 7u};
+  ret = rmw_validate_full_topic_names_batch(&names, lengths, validation_results, invalid_indices);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[0]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NOT_ABSOLUTE, validation_results[1]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH, validation_results[2]);
+  EXPECT_EQ(6u, invalid_indices[2]);
+
+  // with invalid_indices as NULL, on a range of the array as when splitting it across threads
+  rcutils_string_array_t range = names;
+  range.size = 2u;
+  range.data = &data[1];
+  validation_results[1] = validation_results[2] = -1;
+  ret = rmw_validate_full_topic_names_batch(&range, nullptr, &validation_results[1], nullptr);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NOT_ABSOLUTE, validation_results[1]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, validation_results[2]);
+
+  // empty arrays need no results
+  rcutils_string_array_t empty = rcutils_get_zero_initialized_string_array();
+  ret = rmw_validate_full_topic_names_batch(&empty, nullptr, nullptr, nullptr);
+  EXPECT_EQ(RMW_RET_OK, ret);
+
+  ret = rmw_validate_full_topic_names_batch(nullptr, nullptr, validation_results, invalid_indices);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, ret);
+  rmw_reset_error();
+
+  ret = rmw_validate_full_topic_names_batch(&names, nullptr, nullptr, invalid_indices);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, ret);
+  rmw_reset_error();
+
+  // a null string stops validation
+  data[1] = nullptr;
+  validation_results[0] = validation_results[2] = -1;
+  ret = rmw_validate_full_topic_names_batch(&names, nullptr, validation_results, invalid_indices);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, ret);
+  rmw_reset_error();
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[0]);
+  EXPECT_EQ(-1, validation_results[2]);
+}
+
+TEST(test_validate_names_batch, validators) {
+  char valid_node_name[] = "node_name";
+  char invalid_node_name[] = "node/name";
+  char valid_namespace[] = "/name/space";
+  char invalid_namespace[] = "/name/space/";
+  char * node_name_data[] = {valid_node_name, invalid_node_name};
+  char * namespace_data[] = {valid_namespace, invalid_namespace};
+  rcutils_string_array_t names = rcutils_get_zero_initialized_string_array();
+  names.size = 2u;
+  int validation_results[2] = {-1, -1};
+
+  names.data = node_name_data;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_validate_node_names_batch(&names, nullptr, validation_results, nullptr));
+  EXPECT_EQ(RMW_NODE_NAME_VALID, validation_results[0]);
+  EXPECT_EQ(RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS, validation_results[1]);
+
+  names.data = namespace_data;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_validate_namespaces_batch(&names, nullptr, validation_results, nullptr));
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_results[0]);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH, validation_results[1]);
+}
@@ -0,0 +1,122 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rmw/impl/cpp/validate_names.hpp"
+
+using rmw::impl::cpp::NameValidation;
+using rmw::impl::cpp::is_valid_full_topic_name;
+using rmw::impl::cpp::is_valid_namespace;
+using rmw::impl::cpp::is_valid_node_name;
+using rmw::impl::cpp::validate_full_topic_name;
+using rmw::impl::cpp::validate_namespace;
+using rmw::impl::cpp::validate_node_name;
+
+namespace
+{
+constexpr bool
+operator==(const NameValidation & lhs, const NameValidation & rhs)
+{
+  return lhs.validation_result == rhs.validation_result &&
+         lhs.invalid_index == rhs.invalid_index;
+}
+
+using c_validator_t = rmw_ret_t (*)(const char *, size_t, int *, size_t *);
+using cpp_validator_t = NameValidation (*)(std::string_view) noexcept;
+
+::testing::AssertionResult
+same_validation(c_validator_t c_validator, cpp_validator_t cpp_validator, const std::string & name)
+{
+  NameValidation expected{-1, 0u};
+  if (RMW_RET_OK != c_validator(
+      name.data(), name.size(), &expected.validation_result, &expected.invalid_index))
+  {
+    return ::testing::AssertionFailure() << "C validation of '" << name << "' failed";
+  }
+  const NameValidation actual = cpp_validator(name);
+  if (actual == expected) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure() <<
+         "'" << name << "': got (" << actual.validation_result << ", " << actual.invalid_index <<
+         "), expected (" << expected.validation_result << ", " << expected.invalid_index << ")";
+}
+}  // namespace
+
+// Names can be checked at compile time.
+static_assert(is_valid_full_topic_name("/chatter"));
+static_assert(is_valid_full_topic_name("/ns/sub_ns/topic_42"));
+static_assert(!is_valid_full_topic_name("chatter"));
+static_assert(
+  validate_full_topic_name("/ns//topic") ==
+  NameValidation{RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH, 4u});
+static_assert(
+  validate_full_topic_name("/ns/42") ==
+  NameValidation{RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, 4u});
+static_assert(is_valid_node_name("talker"));
+static_assert(
+  validate_node_name("42talker") == NameValidation{RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER, 0u});
+static_assert(
+  validate_node_name("my-node") ==
+  NameValidation{RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS, 2u});
+static_assert(is_valid_namespace("/"));
+static_assert(is_valid_namespace("/robot_1"));
+static_assert(
+  validate_namespace("/robot/") ==
+  NameValidation{RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH, 6u});
+
+TEST(test_validate_names_constexpr, too_long) {
+  const std::string long_topic = "/" + std::string(RMW_TOPIC_MAX_NAME_LENGTH, 'a');
+  EXPECT_FALSE(is_valid_full_topic_name(long_topic));
+  EXPECT_TRUE(same_validation(
+      rmw_validate_full_topic_name_with_size, validate_full_topic_name, long_topic));
+
+  const std::string long_node_name(RMW_NODE_NAME_MAX_NAME_LENGTH + 1u, 'a');
+  EXPECT_FALSE(is_valid_node_name(long_node_name));
+  EXPECT_TRUE(same_validation(
+      rmw_validate_node_name_with_size, validate_node_name, long_node_name));
+
+  const std::string long_namespace = "/" + std::string(RMW_NAMESPACE_MAX_LENGTH, 'a');
+  EXPECT_FALSE(is_valid_namespace(long_namespace));
+  EXPECT_TRUE(same_validation(
+      rmw_validate_namespace_with_size, validate_namespace, long_namespace));
+}
+
+TEST(test_validate_names_constexpr, same_as_c) {
+  // All names of up to 5 characters out of one character of each class
+  const std::string alphabet("/_a0Z9-\0", 8u);
+  std::vector<std::string> names = {""};
+  for (size_t length = 1u; length <= 5u; ++length) {
+    const size_t previous_count = names.size();
+    for (size_t i = 0u; i < previous_count; ++i) {
+      if (names[i].size() + 1u != length) {
+        continue;
+      }
+      for (char c : alphabet) {
+        names.push_back(names[i] + c);
+      }
+    }
+  }
+  for (const std::string & name : names) {
+    ASSERT_TRUE(
+      same_validation(rmw_validate_full_topic_name_with_size, validate_full_topic_name, name));
+    ASSERT_TRUE(same_validation(rmw_validate_node_name_with_size, validate_node_name, name));
+    ASSERT_TRUE(same_validation(rmw_validate_namespace_with_size, validate_namespace, name));
+  }
+}
@@ -0,0 +1,310 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Checks the name validators against the straightforward two-pass implementation they
+// replaced, which is kept here as the reference.
+
+#include <cctype>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/isalnum_no_locale.h"
+
+#include "rmw/validate_full_topic_name.h"
+#include "rmw/validate_namespace.h"
+#include "rmw/validate_node_name.h"
+
+namespace reference
+{
+rmw_ret_t
+validate_full_topic_name_with_size(
+  const char * topic_name,
+  size_t topic_name_length,
+  int * validation_result,
+  size_t * invalid_index)
+{
+  if (topic_name_length == 0) {
+    *validation_result = RMW_TOPIC_INVALID_IS_EMPTY_STRING;
+    *invalid_index = 0;
+    return RMW_RET_OK;
+  }
+  if (topic_name[0] != '/') {
+    *validation_result = RMW_TOPIC_INVALID_NOT_ABSOLUTE;
+    *invalid_index = 0;
+    return RMW_RET_OK;
+  }
+  if (topic_name[topic_name_length - 1] == '/') {
+    *validation_result = RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH;
+    *invalid_index = topic_name_length - 1;
+    return RMW_RET_OK;
+  }
+  for (size_t i = 0; i < topic_name_length; ++i) {
+    if (!rcutils_isalnum_no_locale(topic_name[i]) && topic_name[i] != '_' &&
+      topic_name[i] != '/')
+    {
+      *validation_result = RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
+      *invalid_index = i;
+      return RMW_RET_OK;
+    }
+  }
+  for (size_t i = 0; i + 1 < topic_name_length; ++i) {
+    if (topic_name[i] == '/') {
+      if (topic_name[i + 1] == '/') {
+        *validation_result = RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
+        *invalid_index = i + 1;
+        return RMW_RET_OK;
+      }
+      if (isdigit(topic_name[i + 1]) != 0) {
+        *validation_result = RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
+        *invalid_index = i + 1;
+        return RMW_RET_OK;
+      }
+    }
+  }
+  if (topic_name_length > RMW_TOPIC_MAX_NAME_LENGTH) {
+    *validation_result = RMW_TOPIC_INVALID_TOO_LONG;
+    *invalid_index = RMW_TOPIC_MAX_NAME_LENGTH - 1;
+    return RMW_RET_OK;
+  }
+  *validation_result = RMW_TOPIC_VALID;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+validate_node_name_with_size(
+  const char * node_name,
+  size_t node_name_length,
+  int * validation_result,
+  size_t * invalid_index)
+{
+  if (node_name_length == 0) {
+    *validation_result = RMW_NODE_NAME_INVALID_IS_EMPTY_STRING;
+    *invalid_index = 0;
+    return RMW_RET_OK;
+  }
+  for (size_t i = 0; i < node_name_length; ++i) {
+    if (!rcutils_isalnum_no_locale(node_name[i]) && node_name[i] != '_') {
+      *validation_result = RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
+      *invalid_index = i;
+      return RMW_RET_OK;
+    }
+  }
+  if (isdigit(node_name[0]) != 0) {
+    *validation_result = RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER;
+    *invalid_index = 0;
+    return RMW_RET_OK;
+  }
+  if (node_name_length > RMW_NODE_NAME_MAX_NAME_LENGTH) {
+    *validation_result = RMW_NODE_NAME_INVALID_TOO_LONG;
+    *invalid_index = RMW_NODE_NAME_MAX_NAME_LENGTH - 1;
+    return RMW_RET_OK;
+  }
+  *validation_result = RMW_NODE_NAME_VALID;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+validate_namespace_with_size(
+  const char * namespace_,
+  size_t namespace_length,
+  int * validation_result,
+  size_t * invalid_index)
+{
+  if (namespace_length == 1 && namespace_[0] == '/') {
+    *validation_result = RMW_NAMESPACE_VALID;
+    return RMW_RET_OK;
+  }
+  int t_validation_result;
+  size_t t_invalid_index;
+  // The original called strlen() here, ignoring namespace_length
+  rmw_ret_t ret = validate_full_topic_name_with_size(
+    namespace_, namespace_length, &t_validation_result, &t_invalid_index);
+  if (ret != RMW_RET_OK) {
+    return ret;
+  }
+  if (t_validation_result != RMW_TOPIC_VALID && t_validation_result != RMW_TOPIC_INVALID_TOO_LONG) {
+    // Topic and namespace result codes match, except for the too long one
+    *validation_result = t_validation_result;
+    *invalid_index = t_invalid_index;
+    return RMW_RET_OK;
+  }
+  if (namespace_length > RMW_NAMESPACE_MAX_LENGTH) {
+    *validation_result = RMW_NAMESPACE_INVALID_TOO_LONG;
+    *invalid_index = RMW_NAMESPACE_MAX_LENGTH - 1;
+    return RMW_RET_OK;
+  }
+  *validation_result = RMW_NAMESPACE_VALID;
+  return RMW_RET_OK;
+}
+}  // namespace reference
+
+namespace
+{
+using validator_t = rmw_ret_t (*)(const char *, size_t, int *, size_t *);
+
+// Sentinel telling apart an untouched invalid index.
+constexpr size_t kUnsetIndex = SIZE_MAX;
+
+::testing::AssertionResult
+same_validation(validator_t actual, validator_t expected, const std::string & name)
+{
+  int actual_result = -1;
+  int expected_result = -1;
+  size_t actual_index = kUnsetIndex;
+  size_t expected_index = kUnsetIndex;
+  const rmw_ret_t actual_ret = actual(name.data(), name.size(), &actual_result, &actual_index);
+  const rmw_ret_t expected_ret =
+    expected(name.data(), name.size(), &expected_result, &expected_index);
+  if (actual_ret == expected_ret && actual_result == expected_result &&
+    actual_index == expected_index)
+  {
+    return ::testing::AssertionSuccess();
+  }
+  std::string printable;
+  for (char c : name) {
+    printable += std::isprint(static_cast<unsigned char>(c)) ?
+      std::string(1, c) : "\\x" + std::to_string(static_cast<unsigned char>(c));
+  }
+  return ::testing::AssertionFailure() <<
+         "'" << printable << "' (length " << name.size() << "): got (" << actual_ret << ", " <<
+         actual_result << ", " << actual_index << "), expected (" << expected_ret << ", " <<
+         expected_result << ", " << expected_index << ")";
+}
+
+::testing::AssertionResult
+same_validations(const std::string & name)
+{
+  auto result = same_validation(
+    rmw_validate_full_topic_name_with_size, reference::validate_full_topic_name_with_size, name);
+  if (result) {
+    result = same_validation(
+      rmw_validate_node_name_with_size, reference::validate_node_name_with_size, name);
+  }
+  if (result) {
+    result = same_validation(
+      rmw_validate_namespace_with_size, reference::validate_namespace_with_size, name);
+  }
+  return result;
+}
+
+// Call `check` on all strings of up to `max_length` characters out of `alphabet`.
+template<typename CheckT>
+void
+for_all_strings(const std::string & alphabet, size_t max_length, CheckT check)
+{
+  std::string name;
+  std::vector<size_t> digits;
+  for (size_t length = 0u; length <= max_length; ++length) {
+    digits.assign(length, 0u);
+    name.assign(length, alphabet[0]);
+    while (true) {
+      if (!check(name)) {
+        return;
+      }
+      size_t position = 0u;
+      while (position < length && ++digits[position] == alphabet.size()) {
+        digits[position] = 0u;
+        name[position] = alphabet[0];
+        ++position;
+      }
+      if (position == length) {
+        break;
+      }
+      name[position] = alphabet[digits[position]];
+    }
+  }
+}
+}  // namespace
+
+TEST(test_validate_names_differential, all_short_names) {
+  // One character of each class, and of each boundary of the classes
+  const std::string alphabet("/_a0Z9-\0\xff", 9u);
+  size_t count = 0u;
+  for_all_strings(
+    alphabet, 6u, [&count](const std::string & name) {
+      ++count;
+      auto result = same_validations(name);
+      EXPECT_TRUE(result);
+      return static_cast<bool>(result);
+    });
+  EXPECT_EQ(597871u, count);
+}
+
+TEST(test_validate_names_differential, all_bytes_at_all_positions) {
+  // Long enough to span several blocks of any SIMD width
+  std::string base = "/";
+  while (base.size() < 200u) {
+    base += "abc_DEF/ghi9/x";
+  }
+  base.back() = 'z';
+  ASSERT_TRUE(same_validations(base));
+  for (size_t position = 0u; position < base.size(); ++position) {
+    for (int byte = 0; byte < 256; ++byte) {
+      std::string name = base;
+      name[position] = static_cast<char>(byte);
+      ASSERT_TRUE(same_validations(name));
+    }
+  }
+}
+
+TEST(test_validate_names_differential, tokens_across_block_boundaries) {
+  for (size_t length = 2u; length < 300u; ++length) {
+    for (size_t slash = 0u; slash + 1u < length; ++slash) {
+      for (char next : {'/', '5', 'a'}) {
+        std::string name(length, 'a');
+        name[0] = '/';
+        name[slash] = '/';
+        name[slash + 1u] = next;
+        ASSERT_TRUE(same_validations(name));
+      }
+    }
+  }
+}
+
+TEST(test_validate_names_differential, lengths_around_limits) {
+  for (size_t length = 1u; length < 600u; ++length) {
+    std::string name(length, 'a');
+    ASSERT_TRUE(same_validations(name));
+    name[0] = '/';
+    ASSERT_TRUE(same_validations(name));
+    name.back() = '-';
+    ASSERT_TRUE(same_validations(name));
+  }
+}
+
+TEST(test_validate_names_differential, random_names) {
+  std::mt19937 generator(42u);
+  // Mostly allowed characters, so that scanning gets far into the names
+  const std::string alphabet("abcxyzABCXYZ0123456789____////-.~ \t\x80\xff");
+  const size_t allowed_count = 30u;
+  std::uniform_int_distribution<size_t> length_distribution(0u, 400u);
+  std::uniform_int_distribution<size_t> char_distribution(0u, alphabet.size() - 1u);
+  std::uniform_int_distribution<int> rare_distribution(0, 500);
+  for (size_t i = 0u; i < 20000u; ++i) {
+    std::string name(length_distribution(generator), 'a');
+    for (char & c : name) {
+      // Keep most names free of unallowed characters
+      const size_t choice = char_distribution(generator);
+      c = alphabet[rare_distribution(generator) == 0 ? choice : choice % allowed_count];
+    }
+    if (!name.empty() && i % 2u == 0u) {
+      name[0] = '/';
+    }
+    ASSERT_TRUE(same_validations(name));
+  }
+}
@@ -242,3 +242,33 @@ TEST(test_validate_namespace, topic_too_long) {
 
   ASSERT_NE((char *)nullptr, rmw_namespace_validation_result_string(validation_result));
 }
+
+TEST(test_validate_namespace, with_size) {
+  int validation_result;
+  size_t invalid_index = 42u;
+  rmw_ret_t ret;
+
+  // Only the given number of characters is validated, not the whole string
+  ret = rmw_validate_namespace_with_size("/valid//invalid", 6u, &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_result);
+  EXPECT_EQ(42u, invalid_index);
+
+  ret = rmw_validate_namespace_with_size("/valid//invalid", 7u, &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH, validation_result);
+  EXPECT_EQ(6u, invalid_index);
+
+  ret = rmw_validate_namespace_with_size("/", 0u, &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_IS_EMPTY_STRING, validation_result);
+  EXPECT_EQ(0u, invalid_index);
+
+  // Embedded null characters are not allowed
+  const char with_null[] = "/with\0null";
+  ret = rmw_validate_namespace_with_size(
+    with_null, sizeof(with_null) - 1u, &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_CONTAINS_UNALLOWED_CHARACTERS, validation_result);
+  EXPECT_EQ(5u, invalid_index);
+}